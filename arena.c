@@ -0,0 +1,20 @@
+// Zunjee, Karen, session and frame arenas carved out of one static block
+#include "arena.h"
+
+_Static_assert(SESSION_ARENA_BYTES + FRAME_ARENA_BYTES + RAM_RESERVED_BYTES <= DTEKV_RAM_BYTES,
+               "arenas do not fit in the board's RAM");
+_Static_assert(SESSION_ARENA_BYTES % ARENA_ALIGN == 0, "frame arena would start misaligned");
+
+static uint8_t ram[SESSION_ARENA_BYTES + FRAME_ARENA_BYTES] __attribute__((aligned(ARENA_ALIGN)));
+
+Arena session_arena = { ram, SESSION_ARENA_BYTES, 0, 0 };
+Arena frame_arena = { ram + SESSION_ARENA_BYTES, FRAME_ARENA_BYTES, 0, 0 };
+
+void *arena_alloc(Arena *a, uint32_t bytes) {
+    bytes = ARENA_ROUND(bytes);
+    if (bytes > a->size - a->used) return 0;
+    void *p = a->base + a->used;
+    a->used += bytes;
+    if (a->used > a->peak) a->peak = a->used;
+    return p;
+}
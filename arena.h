@@ -0,0 +1,44 @@
+// Zunjee, Karen, bump allocators over one RAM block reserved at link time:
+// a session arena for the game being played and a scratch arena for one scheduler tick
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+
+// RAM budget, checked at compile time in arena.c and by each user of the arenas
+#define DTEKV_RAM_BYTES 0x4000000               // SDRAM, everything below the I/O area at 0x4000000
+#define RAM_RESERVED_BYTES 0x100000             // Code, the other statics and the stack
+#define SESSION_ARENA_BYTES (320 * 1024)        // Largest game: GIANT board plus its hint maps
+#define FRAME_ARENA_BYTES (32 * 1024)           // Solver scratch, live for one tick at most
+#define ARENA_ALIGN 8
+
+#define ARENA_ROUND(bytes) (((bytes) + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1))
+
+typedef struct {
+    uint8_t *base;
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;      // Most ever in use, for tuning the sizes above
+} Arena;
+
+// Emptied when the menu comes back, a game allocates what its level needs on entry
+extern Arena session_arena;
+// Emptied at the start of every tick, users normally release their scratch before returning
+extern Arena frame_arena;
+
+void *arena_alloc(Arena *a, uint32_t bytes);    // ARENA_ALIGN aligned and not cleared, NULL when full
+
+// Everything allocated after a mark goes away with arena_release
+static inline uint32_t arena_mark(const Arena *a) {
+    return a->used;
+}
+
+static inline void arena_release(Arena *a, uint32_t mark) {
+    a->used = mark;
+}
+
+static inline void arena_reset(Arena *a) {
+    a->used = 0;
+}
+
+#endif
@@ -0,0 +1,347 @@
+// Generated by tools/rle_pack from tools/art, run make -C tools art after changing an image
+#include "art.h"
+
+static const uint8_t menu_bg_data[4301] = {
+    0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05,
+    0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x2B, 0x05, 0x80, 0xFF, 0x12, 0x05, 0x7F, 0x05,
+    0x7F, 0x05, 0x3F, 0x05, 0x45, 0x05, 0x80, 0xFF, 0x7F, 0x05, 0x78, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x0D, 0x05, 0x80, 0xFF, 0x7F, 0x05, 0x7F, 0x05, 0x30, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x65, 0x05, 0x73, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x73, 0xB7, 0x65, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x1F, 0x05, 0x80, 0xFF, 0x44, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F,
+    0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7,
+    0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F,
+    0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7,
+    0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F,
+    0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7,
+    0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F,
+    0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7,
+    0x65, 0x05, 0x27, 0x05, 0x80, 0xFF, 0x3C, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7,
+    0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05,
+    0x81, 0xB7, 0xB7, 0x6F, 0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x81, 0xB7, 0xB7, 0x6F,
+    0x01, 0x81, 0xB7, 0xB7, 0x65, 0x05, 0x65, 0x05, 0x73, 0xB7, 0x47, 0x05, 0x80, 0xFF, 0x1C, 0x05,
+    0x65, 0x05, 0x73, 0xB7, 0x65, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05,
+    0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05,
+    0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x7F, 0x05, 0x33, 0x05, 0x80, 0xFF, 0x7F, 0x05, 0x0A, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05,
+    0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05,
+    0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05, 0x7F, 0x05, 0x7F, 0x05,
+    0x3F, 0x05, 0x7F, 0x05, 0x65, 0x05, 0x80, 0xFF, 0x58, 0x05, 0x7F, 0x05, 0x7F, 0x05, 0x3F, 0x05,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x13, 0x2A, 0x80, 0xFF,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x2A, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x3B, 0x2A, 0x80, 0xFF,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x02, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x13, 0x2A, 0x80, 0xFF, 0x2A, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A, 0x7F, 0x2A, 0x3F, 0x2A, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x3F, 0x2A, 0x2A, 0x2A, 0x81, 0x00, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x12, 0x2A, 0x2A,
+    0x2A, 0x81, 0x00, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x12, 0x2A, 0x2A, 0x2A, 0x81, 0x00, 0x00, 0x7F,
+    0x2A, 0x7F, 0x2A, 0x12, 0x2A, 0x2A, 0x2A, 0x81, 0x00, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x12, 0x2A,
+    0x2A, 0x2A, 0x81, 0x00, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x12, 0x2A, 0x1E, 0x2A, 0x81, 0x00, 0x00,
+    0x09, 0x2A, 0x81, 0x00, 0x00, 0x09, 0x2A, 0x81, 0x00, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x06, 0x2A,
+    0x1E, 0x2A, 0x02, 0x00, 0x06, 0x2A, 0x05, 0x00, 0x06, 0x2A, 0x02, 0x00, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x06, 0x2A, 0x1F, 0x2A, 0x02, 0x00, 0x02, 0x2A, 0x0B, 0x00, 0x02, 0x2A, 0x02, 0x00, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x07, 0x2A, 0x20, 0x2A, 0x02, 0x00, 0x80, 0x2A, 0x0D, 0x00, 0x80, 0x2A, 0x02, 0x00,
+    0x7F, 0x2A, 0x7F, 0x2A, 0x08, 0x2A, 0x21, 0x2A, 0x13, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x09, 0x2A,
+    0x22, 0x2A, 0x11, 0x00, 0x7F, 0x2A, 0x7F, 0x2A, 0x0A, 0x2A, 0x21, 0x2A, 0x13, 0x00, 0x7F, 0x2A,
+    0x7F, 0x2A, 0x09, 0x2A, 0x20, 0x2A, 0x04, 0x00, 0x03, 0xFF, 0x0C, 0x00, 0x7F, 0x2A, 0x7F, 0x2A,
+    0x08, 0x2A, 0x20, 0x2E, 0x04, 0x00, 0x03, 0xFF, 0x0C, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x08, 0x2E,
+    0x20, 0x2E, 0x04, 0x00, 0x03, 0xFF, 0x0C, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x08, 0x2E, 0x1F, 0x2E,
+    0x05, 0x00, 0x03, 0xFF, 0x0D, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x07, 0x2E, 0x1F, 0x2E, 0x17, 0x00,
+    0x7F, 0x2E, 0x7F, 0x2E, 0x07, 0x2E, 0x19, 0x2E, 0x23, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x81, 0x2E,
+    0x2E, 0x19, 0x2E, 0x23, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x81, 0x2E, 0x2E, 0x1F, 0x2E, 0x17, 0x00,
+    0x7F, 0x2E, 0x7F, 0x2E, 0x07, 0x2E, 0x1F, 0x2E, 0x17, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x07, 0x2E,
+    0x20, 0x2E, 0x15, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x08, 0x2E, 0x20, 0x2E, 0x15, 0x00, 0x7F, 0x2E,
+    0x7F, 0x2E, 0x08, 0x2E, 0x20, 0x2E, 0x15, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x08, 0x2E, 0x21, 0x2E,
+    0x13, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x09, 0x2E, 0x22, 0x2E, 0x11, 0x00, 0x7F, 0x2E, 0x7F, 0x2E,
+    0x0A, 0x2E, 0x21, 0x2E, 0x13, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x09, 0x2E, 0x20, 0x2E, 0x02, 0x00,
+    0x80, 0x2E, 0x0D, 0x00, 0x80, 0x2E, 0x02, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x08, 0x2E, 0x1F, 0x2E,
+    0x02, 0x00, 0x02, 0x2E, 0x0B, 0x00, 0x02, 0x2E, 0x02, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x07, 0x2E,
+    0x1E, 0x2E, 0x02, 0x00, 0x06, 0x2E, 0x05, 0x00, 0x06, 0x2E, 0x02, 0x00, 0x7F, 0x2E, 0x7F, 0x2E,
+    0x06, 0x2E, 0x1E, 0x2E, 0x81, 0x00, 0x00, 0x09, 0x2E, 0x81, 0x00, 0x00, 0x09, 0x2E, 0x81, 0x00,
+    0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x06, 0x2E, 0x2A, 0x2E, 0x81, 0x00, 0x00, 0x7F, 0x2E, 0x7F, 0x2E,
+    0x12, 0x2E, 0x2A, 0x2E, 0x81, 0x00, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x12, 0x2E, 0x2A, 0x2E, 0x81,
+    0x00, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x12, 0x2E, 0x2A, 0x2E, 0x81, 0x00, 0x00, 0x7F, 0x2E, 0x7F,
+    0x2E, 0x12, 0x2E, 0x2A, 0x2E, 0x81, 0x00, 0x00, 0x7F, 0x2E, 0x7F, 0x2E, 0x12, 0x2E, 0x7F, 0x2E,
+    0x7F, 0x2E, 0x3F, 0x2E, 0x7F, 0x2E, 0x7F, 0x2E, 0x3F, 0x2E, 0x7F, 0x2E, 0x7F, 0x2E, 0x3F, 0x2E,
+    0x7F, 0x2E, 0x7F, 0x2E, 0x3F, 0x2E, 0x7F, 0x2E, 0x7F, 0x2E, 0x3F, 0x2E, 0x7F, 0x4E, 0x7F, 0x4E,
+    0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E,
+    0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E,
+    0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E,
+    0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E,
+    0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7F, 0x4E, 0x3F, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x2D, 0x00,
+    0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x2D, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00,
+    0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F,
+    0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF,
+    0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C,
+    0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00,
+    0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E,
+    0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02,
+    0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E,
+    0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C,
+    0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D,
+    0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00,
+    0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80,
+    0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF,
+    0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E,
+    0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13,
+    0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00,
+    0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x81, 0x00, 0x00, 0x0C, 0xEF, 0x80,
+    0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x02, 0x00, 0x13, 0x4E, 0x7F, 0x4E, 0x7D, 0x4E, 0x2D,
+    0x00, 0x13, 0x4E, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF,
+    0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C,
+    0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D,
+    0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00,
+    0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80,
+    0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E,
+    0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53,
+    0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13,
+    0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00,
+    0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80,
+    0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81,
+    0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53,
+    0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C,
+    0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00,
+    0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00,
+    0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F,
+    0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E,
+    0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x2D, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53,
+    0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13,
+    0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00,
+    0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80,
+    0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81,
+    0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53,
+    0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C,
+    0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00,
+    0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00,
+    0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F,
+    0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E,
+    0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C,
+    0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00,
+    0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53,
+    0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02,
+    0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C, 0xAF, 0x80, 0x00, 0x0C, 0x7E,
+    0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x81, 0x00, 0x00, 0x0C,
+    0xAF, 0x80, 0x00, 0x0C, 0x7E, 0x80, 0x00, 0x0C, 0x7E, 0x02, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D,
+    0x53, 0x2D, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D, 0x53, 0x2D, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7D,
+    0x53, 0x2D, 0x00, 0x13, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F,
+    0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F,
+    0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F,
+    0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F,
+    0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F,
+    0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F,
+    0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F, 0x53, 0x7F, 0x53, 0x7F, 0x53, 0x3F,
+    0x53, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49,
+    0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11,
+    0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF,
+    0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81,
+    0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49,
+    0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49,
+    0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11,
+    0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF,
+    0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81,
+    0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49, 0x49, 0x11, 0xFF, 0x81, 0x49,
+    0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81,
+    0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49, 0x81,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49,
+    0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49, 0x49,
+    0x81, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF,
+    0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F,
+    0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83,
+    0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49,
+    0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF,
+    0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92,
+    0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x83, 0x49, 0x49, 0xFF, 0xFF, 0x0F, 0x92, 0x81, 0x49,
+    0x49, 0x7F, 0x49, 0x7F, 0x49, 0x3F, 0x49, 0x7F, 0x49, 0x7F, 0x49, 0x3F, 0x49,
+};
+
+const RleImage art_menu_bg = { 320, 240, -1, 4301, menu_bg_data };
+
+static const uint8_t trophy_data[406] = {
+    0x27, 0xE3, 0x27, 0xE3, 0x27, 0xE3, 0x27, 0xE3, 0x07, 0xE3, 0x17, 0xAC, 0x07, 0xE3, 0x07, 0xE3,
+    0x17, 0xAC, 0x07, 0xE3, 0x07, 0xE3, 0x80, 0xAC, 0x15, 0xF8, 0x80, 0xAC, 0x07, 0xE3, 0x02, 0xE3,
+    0x21, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x21, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x03,
+    0xE3, 0x80, 0xAC, 0x13, 0xF8, 0x80, 0xAC, 0x03, 0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3,
+    0x81, 0xF8, 0xF8, 0x03, 0xE3, 0x82, 0xAC, 0xF8, 0xF8, 0x02, 0xFE, 0x0E, 0xF8, 0x80, 0xAC, 0x03,
+    0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x04, 0xE3, 0x81, 0xAC, 0xF8,
+    0x02, 0xFE, 0x0D, 0xF8, 0x80, 0xAC, 0x04, 0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81,
+    0xF8, 0xF8, 0x04, 0xE3, 0x81, 0xAC, 0xF8, 0x02, 0xFE, 0x0D, 0xF8, 0x80, 0xAC, 0x04, 0xE3, 0x81,
+    0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x05, 0xE3, 0x80, 0xAC, 0x02, 0xFE, 0x0C,
+    0xF8, 0x80, 0xAC, 0x05, 0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x05,
+    0xE3, 0x80, 0xAC, 0x02, 0xFE, 0x0C, 0xF8, 0x80, 0xAC, 0x05, 0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3,
+    0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x06, 0xE3, 0x02, 0xFE, 0x0B, 0xF8, 0x80, 0xAC, 0x06, 0xE3, 0x81,
+    0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x81, 0xF8, 0xF8, 0x06, 0xE3, 0x02, 0xFE, 0x0B, 0xF8, 0x80,
+    0xAC, 0x06, 0xE3, 0x81, 0xF8, 0xF8, 0x02, 0xE3, 0x02, 0xE3, 0x06, 0xF8, 0x01, 0xE3, 0x02, 0xFE,
+    0x0B, 0xF8, 0x80, 0xAC, 0x01, 0xE3, 0x06, 0xF8, 0x02, 0xE3, 0x03, 0xE3, 0x05, 0xF8, 0x02, 0xE3,
+    0x80, 0xAC, 0x0B, 0xF8, 0x80, 0xAC, 0x02, 0xE3, 0x05, 0xF8, 0x03, 0xE3, 0x0C, 0xE3, 0x80, 0xAC,
+    0x0B, 0xF8, 0x80, 0xAC, 0x0C, 0xE3, 0x0D, 0xE3, 0x80, 0xAC, 0x09, 0xF8, 0x80, 0xAC, 0x0D, 0xE3,
+    0x0D, 0xE3, 0x80, 0xAC, 0x09, 0xF8, 0x80, 0xAC, 0x0D, 0xE3, 0x10, 0xE3, 0x80, 0xAC, 0x03, 0xF8,
+    0x80, 0xAC, 0x10, 0xE3, 0x10, 0xE3, 0x80, 0xAC, 0x03, 0xF8, 0x80, 0xAC, 0x10, 0xE3, 0x10, 0xE3,
+    0x80, 0xAC, 0x03, 0xF8, 0x80, 0xAC, 0x10, 0xE3, 0x10, 0xE3, 0x80, 0xAC, 0x03, 0xF8, 0x80, 0xAC,
+    0x10, 0xE3, 0x10, 0xE3, 0x80, 0xAC, 0x03, 0xF8, 0x80, 0xAC, 0x10, 0xE3, 0x10, 0xE3, 0x80, 0xAC,
+    0x03, 0xF8, 0x80, 0xAC, 0x10, 0xE3, 0x10, 0xE3, 0x80, 0xAC, 0x03, 0xF8, 0x80, 0xAC, 0x10, 0xE3,
+    0x0A, 0xE3, 0x11, 0xAC, 0x0A, 0xE3, 0x0A, 0xE3, 0x11, 0xAC, 0x0A, 0xE3, 0x0A, 0xE3, 0x11, 0xAC,
+    0x0A, 0xE3, 0x08, 0xE3, 0x15, 0x64, 0x08, 0xE3, 0x08, 0xE3, 0x15, 0x64, 0x08, 0xE3, 0x08, 0xE3,
+    0x15, 0x64, 0x08, 0xE3, 0x08, 0xE3, 0x15, 0x64, 0x08, 0xE3, 0x08, 0xE3, 0x15, 0x64, 0x08, 0xE3,
+    0x27, 0xE3, 0x27, 0xE3, 0x27, 0xE3,
+};
+
+const RleImage art_trophy = { 40, 40, 227, 406, trophy_data };
+
+static const uint8_t mine_burst_data[556] = {
+    0x27, 0xE3, 0x07, 0xE3, 0x04, 0xF0, 0x0D, 0xE3, 0x04, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x05, 0xF0,
+    0x0B, 0xE3, 0x05, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x05, 0xF0, 0x0B, 0xE3, 0x05, 0xF0, 0x07, 0xE3,
+    0x07, 0xE3, 0x06, 0xF0, 0x01, 0xE3, 0x04, 0xF0, 0x02, 0xE3, 0x06, 0xF0, 0x07, 0xE3, 0x07, 0xE3,
+    0x06, 0xF0, 0x01, 0xE3, 0x04, 0xF0, 0x02, 0xE3, 0x06, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x07, 0xF0,
+    0x00, 0xE3, 0x04, 0xF0, 0x01, 0xE3, 0x07, 0xF0, 0x07, 0xE3, 0x08, 0xE3, 0x06, 0xF0, 0x00, 0xE3,
+    0x84, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0xE3, 0x06, 0xF0, 0x08, 0xE3, 0x08, 0xE3, 0x07, 0xF0,
+    0x85, 0xE4, 0xE4, 0x00, 0x00, 0xE4, 0xE4, 0x07, 0xF0, 0x08, 0xE3, 0x09, 0xE3, 0x03, 0xF0, 0x04,
+    0xE4, 0x81, 0x00, 0x00, 0x04, 0xE4, 0x03, 0xF0, 0x09, 0xE3, 0x0A, 0xE3, 0x81, 0xF0, 0xF0, 0x05,
+    0xE4, 0x81, 0x00, 0x00, 0x05, 0xE4, 0x81, 0xF0, 0xF0, 0x0A, 0xE3, 0x05, 0xE3, 0x04, 0xF0, 0x81,
+    0x00, 0x00, 0x05, 0xE4, 0x81, 0x00, 0x00, 0x05, 0xE4, 0x81, 0x00, 0x00, 0x04, 0xF0, 0x05, 0xE3,
+    0x05, 0xE3, 0x04, 0xF0, 0x02, 0x00, 0x04, 0xE4, 0x81, 0x00, 0x00, 0x04, 0xE4, 0x02, 0x00, 0x04,
+    0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x03, 0xF0, 0x81, 0xE4, 0xE4, 0x02, 0x00, 0x81, 0xE4, 0xE4, 0x05,
+    0x00, 0x81, 0xE4, 0xE4, 0x02, 0x00, 0x81, 0xE4, 0xE4, 0x03, 0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x02,
+    0xF0, 0x03, 0xE4, 0x0D, 0x00, 0x03, 0xE4, 0x02, 0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x02, 0xF0, 0x04,
+    0xE4, 0x0B, 0x00, 0x04, 0xE4, 0x02, 0xF0, 0x05, 0xE3, 0x06, 0xE3, 0x81, 0xF0, 0xF0, 0x04, 0xE4,
+    0x83, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x04, 0xE4, 0x81, 0xF0, 0xF0, 0x06, 0xE3, 0x07, 0xE3,
+    0x04, 0xE4, 0x02, 0x00, 0x81, 0xFF, 0xFF, 0x08, 0x00, 0x04, 0xE4, 0x07, 0xE3, 0x07, 0xF0, 0x04,
+    0xE4, 0x0D, 0x00, 0x04, 0xE4, 0x07, 0xF0, 0x06, 0xF0, 0x19, 0x00, 0x06, 0xF0, 0x06, 0xF0, 0x19,
+    0x00, 0x06, 0xF0, 0x07, 0xF0, 0x04, 0xE4, 0x0D, 0x00, 0x04, 0xE4, 0x07, 0xF0, 0x07, 0xF0, 0x04,
+    0xE4, 0x0D, 0x00, 0x04, 0xE4, 0x07, 0xF0, 0x06, 0xE3, 0x81, 0xF0, 0xF0, 0x04, 0xE4, 0x0B, 0x00,
+    0x04, 0xE4, 0x81, 0xF0, 0xF0, 0x06, 0xE3, 0x05, 0xE3, 0x02, 0xF0, 0x04, 0xE4, 0x0B, 0x00, 0x04,
+    0xE4, 0x02, 0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x02, 0xF0, 0x03, 0xE4, 0x0D, 0x00, 0x03, 0xE4, 0x02,
+    0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x03, 0xF0, 0x81, 0xE4, 0xE4, 0x02, 0x00, 0x81, 0xE4, 0xE4, 0x05,
+    0x00, 0x81, 0xE4, 0xE4, 0x02, 0x00, 0x81, 0xE4, 0xE4, 0x03, 0xF0, 0x05, 0xE3, 0x05, 0xE3, 0x04,
+    0xF0, 0x02, 0x00, 0x04, 0xE4, 0x81, 0x00, 0x00, 0x04, 0xE4, 0x02, 0x00, 0x04, 0xF0, 0x05, 0xE3,
+    0x05, 0xE3, 0x04, 0xF0, 0x81, 0x00, 0x00, 0x05, 0xE4, 0x81, 0x00, 0x00, 0x05, 0xE4, 0x81, 0x00,
+    0x00, 0x04, 0xF0, 0x05, 0xE3, 0x0A, 0xE3, 0x81, 0xF0, 0xF0, 0x05, 0xE4, 0x81, 0x00, 0x00, 0x05,
+    0xE4, 0x81, 0xF0, 0xF0, 0x0A, 0xE3, 0x09, 0xE3, 0x03, 0xF0, 0x04, 0xE4, 0x81, 0x00, 0x00, 0x04,
+    0xE4, 0x03, 0xF0, 0x09, 0xE3, 0x08, 0xE3, 0x07, 0xF0, 0x85, 0xE4, 0xE4, 0x00, 0x00, 0xE4, 0xE4,
+    0x07, 0xF0, 0x08, 0xE3, 0x08, 0xE3, 0x06, 0xF0, 0x01, 0xE3, 0x84, 0xF0, 0x00, 0x00, 0xF0, 0xF0,
+    0x00, 0xE3, 0x06, 0xF0, 0x08, 0xE3, 0x07, 0xE3, 0x07, 0xF0, 0x01, 0xE3, 0x04, 0xF0, 0x00, 0xE3,
+    0x07, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x06, 0xF0, 0x02, 0xE3, 0x04, 0xF0, 0x01, 0xE3, 0x06, 0xF0,
+    0x07, 0xE3, 0x07, 0xE3, 0x06, 0xF0, 0x09, 0xE3, 0x06, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x05, 0xF0,
+    0x0B, 0xE3, 0x05, 0xF0, 0x07, 0xE3, 0x07, 0xE3, 0x05, 0xF0, 0x0B, 0xE3, 0x05, 0xF0, 0x07, 0xE3,
+    0x07, 0xE3, 0x04, 0xF0, 0x0D, 0xE3, 0x04, 0xF0, 0x07, 0xE3, 0x27, 0xE3,
+};
+
+const RleImage art_mine_burst = { 40, 40, 227, 556, mine_burst_data };
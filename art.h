@@ -0,0 +1,11 @@
+// Generated by tools/rle_pack from tools/art, run make -C tools art after changing an image
+#ifndef ART_H
+#define ART_H
+
+#include "rle.h"
+
+extern const RleImage art_menu_bg;       // 320x240, 4301 bytes
+extern const RleImage art_trophy;        // 40x40, 406 bytes
+extern const RleImage art_mine_burst;    // 40x40, 556 bytes
+
+#endif
@@ -0,0 +1,107 @@
+// Zunjee, Karen, fonts used by both games, defined once here and linked in read-only data
+#include "assets.h"
+
+// 8x8 font for ASCII characters 'A' to 'Z', index 0='A', 25='Z'
+const unsigned char font8x8_AZ[26][8] = {
+    // A
+    { 0x00, 0x18, 0x24, 0x42, 0x7E, 0x42, 0x42, 0x00 },
+    // B
+    { 0x00, 0x7C, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x00 },
+    // C
+    { 0x00, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x00 },
+    // D
+    { 0x00, 0x78, 0x44, 0x42, 0x42, 0x44, 0x78, 0x00 },
+    // E
+    { 0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x7E, 0x00 },
+    // F
+    { 0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x00 },
+    // G
+    { 0x00, 0x3C, 0x42, 0x40, 0x4E, 0x42, 0x3C, 0x00 },
+    // H
+    { 0x00, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x00 },
+    // I
+    { 0x00, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00 },
+    // J
+    { 0x00, 0x1E, 0x0C, 0x0C, 0x0C, 0x4C, 0x38, 0x00 },
+    // K
+    { 0x00, 0x42, 0x44, 0x78, 0x44, 0x42, 0x42, 0x00 },
+    // L
+    { 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x00 },
+    // M
+    { 0x00, 0x42, 0x66, 0x5A, 0x5A, 0x42, 0x42, 0x00 },
+    // N
+    { 0x00, 0x42, 0x62, 0x52, 0x4A, 0x46, 0x42, 0x00 },
+    // O
+    { 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00 },
+    // P
+    { 0x00, 0x7C, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x00 },
+    // Q
+    { 0x00, 0x3C, 0x42, 0x42, 0x4A, 0x44, 0x3A, 0x00 },
+    // R      
+    { 0x00, 0x7C, 0x42, 0x42, 0x7C, 0x44, 0x42, 0x00 },
+    // S
+    { 0x00, 0x3C, 0x42, 0x30, 0x0C, 0x42, 0x3C, 0x00 },
+    // T
+    { 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },
+    // U
+    { 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00 },
+    // V
+    { 0x00, 0x42, 0x42, 0x42, 0x24, 0x24, 0x18, 0x00 },
+    // W
+    { 0x00, 0x42, 0x42, 0x5A, 0x5A, 0x66, 0x42, 0x00 },
+    // X
+    { 0x00, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00 },
+    // Y
+    { 0x00, 0x42, 0x24, 0x18, 0x18, 0x18, 0x18, 0x00 },
+    // Z
+    { 0x00, 0x7E, 0x04, 0x18, 0x20, 0x40, 0x7E, 0x00 }
+};
+
+// 8x8 font for digits '0' to '9', same layout as font8x8_AZ
+const unsigned char font8x8_09[10][8] = {
+    { 0x00, 0x3C, 0x46, 0x4A, 0x52, 0x62, 0x3C, 0x00 }, // 0
+    { 0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3C, 0x00 }, // 1
+    { 0x00, 0x3C, 0x42, 0x0C, 0x30, 0x40, 0x7E, 0x00 }, // 2
+    { 0x00, 0x3C, 0x42, 0x1C, 0x02, 0x42, 0x3C, 0x00 }, // 3
+    { 0x00, 0x0C, 0x14, 0x24, 0x7E, 0x04, 0x04, 0x00 }, // 4
+    { 0x00, 0x7E, 0x40, 0x7C, 0x02, 0x42, 0x3C, 0x00 }, // 5
+    { 0x00, 0x3C, 0x40, 0x7C, 0x42, 0x42, 0x3C, 0x00 }, // 6
+    { 0x00, 0x7E, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00 }, // 7
+    { 0x00, 0x3C, 0x42, 0x3C, 0x42, 0x42, 0x3C, 0x00 }, // 8
+    { 0x00, 0x3C, 0x42, 0x42, 0x3E, 0x02, 0x3C, 0x00 }  // 9
+};
+
+// 5x5 bitmap for digits 0–9, 10-16 are drawn as A-G on the 16x16 grid
+const unsigned char digits_compact[17][5] = {
+    {0x1F, 0x11, 0x11, 0x11, 0x1F}, // 0
+    {0x04, 0x06, 0x04, 0x04, 0x1F}, // 1
+    {0x1F, 0x10, 0x1F, 0x01, 0x1F}, // 2
+    {0x1F, 0x10, 0x1F, 0x10, 0x1F}, // 3
+    {0x11, 0x11, 0x1F, 0x10, 0x10}, // 4
+    {0x1F, 0x01, 0x1F, 0x10, 0x1F}, // 5
+    {0x1F, 0x01, 0x1F, 0x11, 0x1F}, // 6
+    {0x1F, 0x10, 0x08, 0x04, 0x02}, // 7
+    {0x1F, 0x11, 0x1F, 0x11, 0x1F}, // 8
+    {0x1F, 0x11, 0x1F, 0x10, 0x1F}, // 9
+    {0x0E, 0x11, 0x1F, 0x11, 0x11}, // A
+    {0x0F, 0x11, 0x0F, 0x11, 0x0F}, // B
+    {0x1E, 0x01, 0x01, 0x01, 0x1E}, // C
+    {0x0F, 0x11, 0x11, 0x11, 0x0F}, // D
+    {0x1F, 0x01, 0x0F, 0x01, 0x1F}, // E
+    {0x1F, 0x01, 0x0F, 0x01, 0x01}, // F
+    {0x1E, 0x01, 0x19, 0x11, 0x1E}  // G
+};
+
+// 5x7 digits for the Minesweeper counts, one byte per column
+const unsigned char font5x7_digits[10][5] = {
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0
+    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, // 2
+    {0x21, 0x41, 0x45, 0x4B, 0x31}, // 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 4
+    {0x27, 0x45, 0x45, 0x45, 0x39}, // 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, // 6
+    {0x01, 0x71, 0x09, 0x05, 0x03}, // 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, // 8
+    {0x06, 0x49, 0x49, 0x29, 0x1E}  // 9
+};
@@ -0,0 +1,15 @@
+// Zunjee, Karen, read-only art shared by the games: one definition of each font in assets.c
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// 8x8 fonts, one byte per row, leftmost pixel in bit 7 (GLYPH_ROWS_MSB)
+extern const unsigned char font8x8_AZ[26][8];       // 'A' to 'Z'
+extern const unsigned char font8x8_09[10][8];       // '0' to '9'
+
+// Sudoku cell digits 0-9 and A-G, one byte per row, leftmost pixel in bit 0 (GLYPH_ROWS_LSB)
+extern const unsigned char digits_compact[17][5];
+
+// Minesweeper counts 0-9, one byte per column, top pixel in bit 0 (GLYPH_COLS_LSB)
+extern const unsigned char font5x7_digits[10][5];
+
+#endif
@@ -0,0 +1,291 @@
+// Zunjee, Karen, display list renderer: band sort, coverage culling and a single framebuffer sweep
+#include "display_list.h"
+#include "dtekv_board.h"
+#include "profile.h"
+#include "assets.h"
+#include "mmio.h"
+
+_Static_assert(DL_BANDS * DL_BAND_H == SCREEN_H, "bands must cover the screen");
+
+#define DL_MASK_WORDS (SCREEN_W / 32)
+
+static DlCmd cmds[DL_MAX_CMDS];
+static int cmd_count = 0;
+static int ref_total = 0;                   // Sum of bands spanned by all queued commands
+
+static uint16_t band_refs[DL_MAX_REFS];     // Command indices grouped by band, submission order kept
+static int band_start[DL_BANDS + 1];
+
+static DlStats building;    // Counters for the frame being emitted
+static DlStats last;        // Counters for the last flushed frame
+
+// First and last band touched by a command, returns 0 if it is off screen
+static int cmd_bands(const DlCmd *c, int *b0, int *b1) {
+    int h = c->h * (c->type == DL_GLYPH ? c->scale : 1);
+    int w = c->w * (c->type == DL_GLYPH ? c->scale : 1);
+    int y0 = c->y, y1 = c->y + h;
+    if (y0 < 0) y0 = 0;
+    if (y1 > SCREEN_H) y1 = SCREEN_H;
+    if (y0 >= y1 || c->x >= SCREEN_W || c->x + w <= 0) return 0;
+    *b0 = y0 / DL_BAND_H;
+    *b1 = (y1 - 1) / DL_BAND_H;
+    return 1;
+}
+
+static int cmd_band_count(const DlCmd *c) {
+    int b0, b1;
+    if (!cmd_bands(c, &b0, &b1)) return 0;
+    return b1 - b0 + 1;
+}
+
+// True if opaque rect r covers the whole bounding box of c
+static int rect_covers(const DlCmd *r, const DlCmd *c) {
+    int s = (c->type == DL_GLYPH) ? c->scale : 1;
+    return r->x <= c->x && r->y <= c->y &&
+           r->x + r->w >= c->x + c->w * s && r->y + r->h >= c->y + c->h * s;
+}
+
+// Append a command, merging or dropping against the previous one where the result is identical
+static void dl_push(const DlCmd *c) {
+    int bands = cmd_band_count(c);
+    if (bands == 0) return;
+
+    if (c->type == DL_RECT) {
+        // A new rect hides whatever it fully covers that was emitted just before it
+        while (cmd_count > 0 && rect_covers(c, &cmds[cmd_count - 1])) {
+            cmd_count--;
+            ref_total -= cmd_band_count(&cmds[cmd_count]);
+            building.dropped++;
+        }
+
+        // Same colored rects that touch along a full edge become one rect
+        if (cmd_count > 0) {
+            DlCmd *p = &cmds[cmd_count - 1];
+            if (p->type == DL_RECT && p->color == c->color) {
+                int merged = 0;
+                if (p->y == c->y && p->h == c->h && c->x <= p->x + p->w && c->x + c->w >= p->x) {
+                    int x1 = (p->x + p->w > c->x + c->w) ? p->x + p->w : c->x + c->w;
+                    if (c->x < p->x) p->x = c->x;
+                    p->w = x1 - p->x;
+                    merged = 1;
+                } else if (p->x == c->x && p->w == c->w && c->y <= p->y + p->h && c->y + c->h >= p->y) {
+                    // Taller, it may span more bands: only merged if they still fit, else appended below
+                    int y1 = (p->y + p->h > c->y + c->h) ? p->y + p->h : c->y + c->h;
+                    DlCmd m = *p;
+                    if (c->y < m.y) m.y = c->y;
+                    m.h = (int16_t)(y1 - m.y);
+                    int grown = cmd_band_count(&m) - cmd_band_count(p);
+                    if (ref_total + grown <= DL_MAX_REFS) {
+                        *p = m;
+                        ref_total += grown;
+                        merged = 1;
+                    }
+                }
+                if (merged) {
+                    building.merged++;
+                    return;
+                }
+            }
+        }
+    }
+
+    // Full list: run what we have, painter order across flushes stays the same
+    if (cmd_count == DL_MAX_CMDS || ref_total + bands > DL_MAX_REFS) {
+        dl_flush();
+    }
+
+    cmds[cmd_count++] = *c;
+    ref_total += bands;
+}
+
+void dl_rect(int x, int y, int w, int h, uint8_t color) {
+    if (w <= 0 || h <= 0) return;
+    DlCmd c = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, DL_RECT, color, 0, 1, 0 };
+    dl_push(&c);
+}
+
+void dl_frame(int x, int y, int w, int h, uint8_t color) {
+    if (w <= 0 || h <= 0) return;
+    if (w <= 2 || h <= 2) {     // No interior, same pixels as a filled rect
+        dl_rect(x, y, w, h, color);
+        return;
+    }
+    DlCmd c = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, DL_FRAME, color, 0, 1, 0 };
+    dl_push(&c);
+}
+
+void dl_glyph(int x, int y, const uint8_t *bits, int w, int h, GlyphFormat format, int scale, uint8_t color) {
+    if (w <= 0 || h <= 0 || scale <= 0) return;
+    DlCmd c = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, DL_GLYPH, color,
+                (uint8_t)format, (uint8_t)scale, bits };
+    dl_push(&c);
+}
+
+void dl_tile(int x, int y, int w, int h, const uint8_t *pixels) {
+    if (w <= 0 || h <= 0) return;
+    DlCmd c = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, DL_TILE, 0, 0, 1, pixels };
+    dl_push(&c);
+}
+
+// Row i covers x + insets[i] to x + w - insets[i], insets has h entries
+void dl_shape(int x, int y, int w, int h, const uint8_t *insets, uint8_t color) {
+    if (w <= 0 || h <= 0) return;
+    DlCmd c = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, DL_SHAPE, color, 0, 1, insets };
+    dl_push(&c);
+}
+
+// Same layout as draw_text: 8 pixel advance, A-Z and 0-9, anything else is a blank
+void dl_text(int x, int y, const char *text, uint8_t color) {
+    for (; *text; text++, x += 8) {
+        char ch = *text;
+        if (ch >= 'A' && ch <= 'Z') {
+            dl_glyph(x, y, font8x8_AZ[ch - 'A'], 8, 8, GLYPH_ROWS_MSB, 1, color);
+        } else if (ch >= '0' && ch <= '9') {
+            dl_glyph(x, y, font8x8_09[ch - '0'], 8, 8, GLYPH_ROWS_MSB, 1, color);
+        }
+    }
+}
+
+// Scanline state for the sweep: pixels already written on this row are never written again
+static uint32_t covered[DL_MASK_WORDS];
+static int uncovered;
+
+// Mask of bits lo..hi-1 inside one 32-bit word
+static inline uint32_t bit_range(int lo, int hi) {
+    uint32_t upper = (hi >= 32) ? 0xFFFFFFFFu : ((1u << hi) - 1u);
+    return upper & ~((1u << lo) - 1u);
+}
+
+// Write color on x0..x1-1 of a row, skipping pixels that a later command already wrote
+static void span(uint8_t *row, int x0, int x1, uint8_t color) {
+    if (x0 < 0) x0 = 0;
+    if (x1 > SCREEN_W) x1 = SCREEN_W;
+    int x = x0;
+    while (x < x1) {
+        int word = x >> 5;
+        int end = (word + 1) << 5;
+        if (end > x1) end = x1;
+        uint32_t want = bit_range(x & 31, end - (word << 5));
+        uint32_t todo = want & ~covered[word];
+        if (todo == want) {
+            for (int i = x; i < end; i++) row[i] = color;
+            uncovered -= end - x;
+            last.pixels += end - x;
+        } else if (todo) {
+            for (int i = x; i < end; i++) {
+                if ((todo >> (i & 31)) & 1u) {
+                    row[i] = color;
+                    uncovered--;
+                    last.pixels++;
+                }
+            }
+        }
+        covered[word] |= todo;
+        x = end;
+    }
+}
+
+// Is bit (gx, gy) of a glyph set
+static inline int glyph_bit(const DlCmd *c, int gx, int gy) {
+    switch (c->format) {
+        case GLYPH_ROWS_MSB: return (c->data[gy] >> (7 - gx)) & 1;
+        case GLYPH_ROWS_LSB: return (c->data[gy] >> gx) & 1;
+        default:             return (c->data[gx] >> gy) & 1;
+    }
+}
+
+// Rasterize the part of one command that lies on scanline y
+static void raster_row(const DlCmd *c, uint8_t *row, int y) {
+    switch (c->type) {
+        case DL_RECT:
+            span(row, c->x, c->x + c->w, c->color);
+            break;
+        case DL_FRAME:
+            if (y == c->y || y == c->y + c->h - 1) {
+                span(row, c->x, c->x + c->w, c->color);
+            } else {
+                span(row, c->x, c->x + 1, c->color);
+                span(row, c->x + c->w - 1, c->x + c->w, c->color);
+            }
+            break;
+        case DL_GLYPH: {
+            int gy = (y - c->y) / c->scale;
+            for (int gx = 0; gx < c->w; gx++) {
+                if (glyph_bit(c, gx, gy)) {
+                    int px = c->x + gx * c->scale;
+                    span(row, px, px + c->scale, c->color);
+                }
+            }
+            break;
+        }
+        case DL_TILE: {
+            const uint8_t *src = c->data + (y - c->y) * c->w;
+            for (int tx = 0; tx < c->w; tx++) {
+                span(row, c->x + tx, c->x + tx + 1, src[tx]);
+            }
+            break;
+        }
+        case DL_SHAPE: {
+            int in = c->data[y - c->y];
+            span(row, c->x + in, c->x + c->w - in, c->color);
+            break;
+        }
+    }
+}
+
+void dl_flush(void) {
+    PROF_BEGIN(PROF_DL_FLUSH);
+
+    last = building;
+    last.commands = cmd_count;
+    last.pixels = 0;
+    building.merged = building.dropped = 0;
+
+    // Counting sort of commands into bands, stable so painter order is kept inside a band
+    for (int b = 0; b <= DL_BANDS; b++) band_start[b] = 0;
+    for (int i = 0; i < cmd_count; i++) {
+        int b0, b1;
+        if (!cmd_bands(&cmds[i], &b0, &b1)) continue;
+        for (int b = b0; b <= b1; b++) band_start[b + 1]++;
+    }
+    for (int b = 0; b < DL_BANDS; b++) band_start[b + 1] += band_start[b];
+    {
+        int fill[DL_BANDS];
+        for (int b = 0; b < DL_BANDS; b++) fill[b] = band_start[b];
+        for (int i = 0; i < cmd_count; i++) {
+            int b0, b1;
+            if (!cmd_bands(&cmds[i], &b0, &b1)) continue;
+            for (int b = b0; b <= b1; b++) band_refs[fill[b]++] = (uint16_t)i;
+        }
+    }
+
+    // One sweep top to bottom, each row walks its band's commands front to back
+    uint8_t *screen = (uint8_t *) MMIO_FB_BASE;     // Plain stores, counted per row below
+    for (int band = 0; band < DL_BANDS; band++) {
+        int first = band_start[band], end = band_start[band + 1];
+        if (first == end) continue;
+
+        for (int y = band * DL_BAND_H; y < (band + 1) * DL_BAND_H; y++) {
+            uint8_t *row = screen + y * SCREEN_W;
+            for (int w = 0; w < DL_MASK_WORDS; w++) covered[w] = 0;
+            uncovered = SCREEN_W;
+
+            for (int i = end - 1; i >= first && uncovered > 0; i--) {
+                const DlCmd *c = &cmds[band_refs[i]];
+                int h = (c->type == DL_GLYPH) ? c->h * c->scale : c->h;
+                if (y < c->y || y >= c->y + h) continue;
+                raster_row(c, row, y);
+            }
+            MMIO_COUNT(MMIO_FB, writes, SCREEN_W - uncovered);
+        }
+    }
+
+    cmd_count = 0;
+    ref_total = 0;
+
+    PROF_END(PROF_DL_FLUSH);
+}
+
+const DlStats *dl_last_stats(void) {
+    return &last;
+}
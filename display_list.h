@@ -0,0 +1,57 @@
+// Zunjee, Karen, retained display list: games emit draw commands, one sweep writes the framebuffer
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include <stdint.h>
+
+#define DL_MAX_CMDS 1024    // Commands per list, a full list is flushed early (order is kept)
+#define DL_MAX_REFS 4096    // Command-in-band references, a command spanning n bands uses n
+#define DL_BAND_H 16        // Height of one screen band in pixels
+#define DL_BANDS (240 / DL_BAND_H)
+
+// Kinds of draw commands
+typedef enum {
+    DL_RECT,    // Filled rectangle
+    DL_FRAME,   // 1 pixel rectangle outline
+    DL_GLYPH,   // 1-bit bitmap drawn in one color, optionally scaled
+    DL_TILE,    // Block of 8-bit pixels copied as is
+    DL_SHAPE    // Filled rows, each inset from both sides by its byte of data (hex cells)
+} DlCmdType;
+
+// Bit layout of glyph bitmaps, matches the fonts already in the project
+typedef enum {
+    GLYPH_ROWS_MSB,     // One byte per row, leftmost pixel in bit 7 (font8x8_AZ)
+    GLYPH_ROWS_LSB,     // One byte per row, leftmost pixel in bit 0 (digits_compact)
+    GLYPH_COLS_LSB      // One byte per column, top pixel in bit 0 (font5x7_digits)
+} GlyphFormat;
+
+typedef struct {
+    int16_t x, y, w, h;     // Bounding box on screen (glyph w/h are before scaling)
+    uint8_t type;           // DlCmdType
+    uint8_t color;
+    uint8_t format;         // GlyphFormat, glyphs only
+    uint8_t scale;          // Pixel size, glyphs only
+    const uint8_t *data;    // Glyph bits, tile pixels or shape row insets
+} DlCmd;
+
+// Counters for the last flushed frame
+typedef struct {
+    int commands;       // Commands executed
+    int merged;         // Rects merged into the previous command when emitted
+    int dropped;        // Commands dropped because a later rect covered them
+    int pixels;         // Framebuffer pixels written
+} DlStats;
+
+// Emitting commands
+void dl_rect(int x, int y, int w, int h, uint8_t color);
+void dl_frame(int x, int y, int w, int h, uint8_t color);
+void dl_glyph(int x, int y, const uint8_t *bits, int w, int h, GlyphFormat format, int scale, uint8_t color);
+void dl_tile(int x, int y, int w, int h, const uint8_t *pixels);
+void dl_shape(int x, int y, int w, int h, const uint8_t *insets, uint8_t color);
+void dl_text(int x, int y, const char *text, uint8_t color);
+
+// Execute and clear the list, caller presents with vga_present()
+void dl_flush(void);
+const DlStats *dl_last_stats(void);
+
+#endif
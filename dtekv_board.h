@@ -3,10 +3,32 @@
 #define DTEKV_BOARD_H
 #include <stdlib.h>
 
-int minesweeper(void);
 void test(void);
 
 // Memory Addresses for VGA
+#ifdef DTEKV_SIM
+// Host simulator (tools/dtekv_sim.c): the devices are plain memory shared with the input script
+#include <stdint.h>
+extern volatile uint32_t sim_io[];      // 0x4000000-0x40001ff
+extern volatile uint8_t sim_vga[];      // 320x240 frame
+#define SIM_IO(offset) ((volatile char *) sim_io + (offset))
+#define VGA_Buffer sim_vga
+#define VGA_DMA SIM_IO(0x100)
+#define SWITCH_base SIM_IO(0x10)
+#define KEY1_base SIM_IO(0xd0)
+#define TIMER_base SIM_IO(0x20)
+#define HEX_base SIM_IO(0x50)
+#define SWITCH_BASE SIM_IO(0x10)
+// The game drives the simulator: busy-waits advance its clock and the input script, presents get hashed
+void sim_idle(unsigned loops);
+void sim_present(void);
+void sim_timer_snap(void);      // Latches the simulated clock into the timer snapshot registers
+void sim_vga_show(const volatile uint8_t *frame);     // The VGA DMA now scans frame out, presents hash it
+#define SIM_IDLE(loops) sim_idle(loops)
+#define SIM_PRESENT() sim_present()
+#define SIM_TIMER_SNAP() sim_timer_snap()
+#define SIM_VGA_SHOW(frame) sim_vga_show(frame)
+#else
 #define VGA_Buffer 0x8000000
 #define VGA_DMA 0x4000100
 #define SWITCH_base 0x4000010
@@ -14,6 +36,15 @@ void test(void);
 #define TIMER_base 0x4000020
 #define HEX_base 0x4000050
 #define SWITCH_BASE 0x4000010  
+#define SIM_IDLE(loops) ((void)0)
+#define SIM_PRESENT() ((void)0)
+#define SIM_TIMER_SNAP() ((void)0)
+#define SIM_VGA_SHOW(frame) ((void)0)
+#endif
+
+// VGA frame, one RGB332 byte per pixel, row major
+#define SCREEN_W 320
+#define SCREEN_H 240
 
 // Colors 
 #define black     0x00
@@ -50,72 +81,12 @@ void test(void);
 #define light_orange 0xF6
 
 // Switch and Key Assignments
-#define SW_l1 1     // easy difficulty
-#define SW_l2 2   // medium difficulty
-#define SW_l3 3   // hard  difficulty
-#define SW_up 4   // move cursor up
-#define SW_down 5   // move cursor down
+#define SW_up 4   // move cursor up, menu highlight up
+#define SW_down 5   // move cursor down, menu highlight down
 #define SW_right 6  // move cursor right
 #define SW_left 7      // move cursor left
-#define SW_ACTION_1 8   // toggle flag mode/ erase cell
+#define SW_ACTION_1 8   // toggle flag mode/ erase cell, menu back
 #define SW_ACTION_2 9 // reveal cell/ enter digit mode
 #define KEY_enter 0 // confirm action (when pressed reads as bit 0 in KEY1)
 
-// 8x8 font for ASCII characters 'A' to 'Z', index 0='A', 25='Z'
-static const unsigned char font8x8_AZ[26][8] = {
-    // A
-    { 0x00, 0x18, 0x24, 0x42, 0x7E, 0x42, 0x42, 0x00 },
-    // B
-    { 0x00, 0x7C, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x00 },
-    // C
-    { 0x00, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x00 },
-    // D
-    { 0x00, 0x78, 0x44, 0x42, 0x42, 0x44, 0x78, 0x00 },
-    // E
-    { 0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x7E, 0x00 },
-    // F
-    { 0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x00 },
-    // G
-    { 0x00, 0x3C, 0x42, 0x40, 0x4E, 0x42, 0x3C, 0x00 },
-    // H
-    { 0x00, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x00 },
-    // I
-    { 0x00, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00 },
-    // J
-    { 0x00, 0x1E, 0x0C, 0x0C, 0x0C, 0x4C, 0x38, 0x00 },
-    // K
-    { 0x00, 0x42, 0x44, 0x78, 0x44, 0x42, 0x42, 0x00 },
-    // L
-    { 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x00 },
-    // M
-    { 0x00, 0x42, 0x66, 0x5A, 0x5A, 0x42, 0x42, 0x00 },
-    // N
-    { 0x00, 0x42, 0x62, 0x52, 0x4A, 0x46, 0x42, 0x00 },
-    // O
-    { 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00 },
-    // P
-    { 0x00, 0x7C, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x00 },
-    // Q
-    { 0x00, 0x3C, 0x42, 0x42, 0x4A, 0x44, 0x3A, 0x00 },
-    // R      
-    { 0x00, 0x7C, 0x42, 0x42, 0x7C, 0x44, 0x42, 0x00 },
-    // S
-    { 0x00, 0x3C, 0x42, 0x30, 0x0C, 0x42, 0x3C, 0x00 },
-    // T
-    { 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },
-    // U
-    { 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00 },
-    // V
-    { 0x00, 0x42, 0x42, 0x42, 0x24, 0x24, 0x18, 0x00 },
-    // W
-    { 0x00, 0x42, 0x42, 0x5A, 0x5A, 0x66, 0x42, 0x00 },
-    // X
-    { 0x00, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00 },
-    // Y
-    { 0x00, 0x42, 0x24, 0x18, 0x18, 0x18, 0x18, 0x00 },
-    // Z
-    { 0x00, 0x7E, 0x04, 0x18, 0x20, 0x40, 0x7E, 0x00 }
-};
-
-
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,154 @@
+// Zunjee, Karen, idle-time pool of ready Sudoku puzzles and shuffled Minesweeper mine orders
+#include <stddef.h>
+#include "game_pool.h"
+#include "timer.h"
+
+#define SUDOKU_ORDERS 3                 // 4x4, 9x9 and 16x16
+#define ORDER_SLICE 1024                // List entries written or shuffled per idle call
+#define MS_POOL_CELLS (9 * 9 + 16 * 12 + 20 * 16 + 100 * 100 + 256 * 256)    // Every level's board, see LEVELS
+
+// One ready game per difficulty and size, taking it empties the slot until the next idle refill
+static SudokuGame sudoku_ready[3][SUDOKU_ORDERS];
+static uint8_t sudoku_full[3][SUDOKU_ORDERS];
+
+// Mine orders: the identity list of the board's cells with its first mines + 9 entries shuffled
+// for a puzzle ID (ms_order_shuffle)
+typedef enum { ORDER_FILL, ORDER_SHUFFLE, ORDER_READY, ORDER_TAKEN, ORDER_NONE } OrderState;   // NONE: does not fit
+
+typedef struct {
+    uint16_t *cells;
+    int count;          // Board cells
+    int need;           // Leading entries place_mines_ordered may read
+    int done;           // Entries filled or shuffled so far
+    uint32_t id;        // Puzzle ID being shuffled for
+    uint32_t rng;       // Its shuffle state, from ms_order_seed
+    OrderState state;
+} MineOrder;
+
+static uint16_t order_cells[MS_POOL_CELLS];
+static MineOrder orders[MS_LEVEL_COUNT];
+static int orders_ready = 0;
+static uint32_t pool_rng = 0x9E3779B9u;
+
+static uint32_t pool_rand(void) {
+    uint32_t r = pool_rng;
+    r ^= (r << 13);
+    r ^= (r >> 17);
+    r ^= (r << 5);
+    pool_rng = r;
+    return r;
+}
+
+// Start the list over for puzzle id, it is filled with the identity again before the shuffle
+static void order_restart(MineOrder *o, MsLevel level, uint32_t id) {
+    o->id = id;
+    o->rng = ms_order_seed(id, level);
+    o->done = 0;
+    o->state = ORDER_FILL;
+}
+
+// Carve the lists out of order_cells, each gets an ID from the pool's own generator
+static void orders_init(void) {
+    int offset = 0;
+    for (int l = 0; l < MS_LEVEL_COUNT; l++) {
+        const LevelSpec *spec = ms_level_spec((MsLevel)l);
+        MineOrder *o = &orders[l];
+        if (offset + spec->rows * spec->cols > MS_POOL_CELLS) {
+            o->state = ORDER_NONE;      // Levels grew past MS_POOL_CELLS, mines are drawn at random
+            continue;
+        }
+        o->cells = &order_cells[offset];
+        o->count = spec->rows * spec->cols;
+        o->need = spec->mines + 9 < o->count ? spec->mines + 9 : o->count;
+        order_restart(o, (MsLevel)l, pool_rand());
+        offset += o->count;
+    }
+    orders_ready = 1;
+}
+
+static int sudoku_slot(SudokuOrder order) {
+    return order - SUDOKU_4X4;
+}
+
+// One slice of work on a list
+static void order_step(MineOrder *o) {
+    int end;
+    switch (o->state) {
+        case ORDER_FILL:
+            end = o->done + ORDER_SLICE < o->count ? o->done + ORDER_SLICE : o->count;
+            for (int i = o->done; i < end; i++) o->cells[i] = (uint16_t)i;
+            o->done = end;
+            if (end == o->count) {
+                o->done = 0;
+                o->state = ORDER_SHUFFLE;
+            }
+            break;
+        case ORDER_SHUFFLE:
+            end = o->done + ORDER_SLICE < o->need ? o->done + ORDER_SLICE : o->need;
+            ms_order_shuffle(o->cells, o->count, o->done, end, &o->rng);
+            o->done = end;
+            if (end == o->need) o->state = ORDER_READY;
+            break;
+        default:
+            break;
+    }
+}
+
+int pool_idle(void) {
+    // Puzzles first, each one is quick
+    for (int d = 0; d < 3; d++) {
+        for (int s = 0; s < SUDOKU_ORDERS; s++) {
+            if (sudoku_full[d][s]) continue;
+            sudoku_init(&sudoku_ready[d][s], (SudokuDifficulty)d, (SudokuOrder)(SUDOKU_4X4 + s), (uint16_t)pool_rand());
+            sudoku_full[d][s] = 1;
+            return 1;
+        }
+    }
+
+    if (!orders_ready) orders_init();
+    for (int l = 0; l < MS_LEVEL_COUNT; l++) {
+        if (orders[l].state == ORDER_FILL || orders[l].state == ORDER_SHUFFLE) {
+            order_step(&orders[l]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int sudoku_pool_base(SudokuDifficulty difficulty, SudokuOrder order) {
+    int s = sudoku_slot(order);
+    if (!sudoku_full[difficulty][s]) return -1;
+    return SUDOKU_ID_BASE(sudoku_ready[difficulty][s].id);
+}
+
+int sudoku_pool_take(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint16_t base) {
+    if (sudoku_pool_base(difficulty, order) != base) return 0;
+    int s = sudoku_slot(order);
+    *game = sudoku_ready[difficulty][s];
+    sudoku_full[difficulty][s] = 0;
+    return 1;
+}
+
+uint32_t ms_pool_id(MsLevel level) {
+    if (!orders_ready) orders_init();
+    return orders[level].id;
+}
+
+const uint16_t *ms_pool_take(MsLevel level, uint32_t id) {
+    if (!orders_ready) orders_init();
+    MineOrder *o = &orders[level];
+    if (o->state == ORDER_NONE) return NULL;
+    if (o->id != id || o->state == ORDER_TAKEN) order_restart(o, level, id);
+    while (o->state != ORDER_READY) order_step(o);     // Whatever the idle calls have not done yet
+    o->state = ORDER_TAKEN;
+    return o->cells;
+}
+
+// The next game gets a new ID, the list is filled again so its shuffle starts from the identity
+void ms_pool_release(MsLevel level) {
+    MineOrder *o = &orders[level];
+    if (!orders_ready || o->state != ORDER_TAKEN) return;
+    pool_rng ^= timer_ms() * 2654435761u;      // How long the game took, so boards differ between power-ons
+    if (pool_rng == 0) pool_rng = 0x9E3779B9u;
+    order_restart(o, level, pool_rand());
+}
@@ -0,0 +1,28 @@
+// Zunjee, Karen, next games prepared in idle time: a Sudoku puzzle for every difficulty and size,
+// and a shuffled mine order for every Minesweeper level
+#ifndef GAME_POOL_H
+#define GAME_POOL_H
+
+#include <stdint.h>
+#include "sudoku.h"
+#include "minesweeper.h"
+
+// Scheduler idle task (sched.h), one puzzle or one stretch of shuffling per call
+int pool_idle(void);
+
+// Base (SUDOKU_ID_BASE) of the ready puzzle, -1 if it is not ready yet
+int sudoku_pool_base(SudokuDifficulty difficulty, SudokuOrder order);
+
+// Copy the ready puzzle into game if it was made from base, 0 when the caller has to generate it
+int sudoku_pool_take(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint16_t base);
+
+// Puzzle ID of the level's next mine order, ready or still being shuffled
+uint32_t ms_pool_id(MsLevel level);
+
+// Mine order of puzzle id for MinesweeperBoard.mine_order, made now unless it is the pool's ready
+// one; NULL if the level does not fit the pool. The list is left alone until it is released,
+// then the pool starts on a new ID for the next game.
+const uint16_t *ms_pool_take(MsLevel level, uint32_t id);
+void ms_pool_release(MsLevel level);
+
+#endif
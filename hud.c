@@ -0,0 +1,223 @@
+// Zunjee, Karen, retained HUD: widgets keep what they last drew and only redraw on a change
+#include "hud.h"
+#include "dtekv_board.h"
+#include "display_list.h"
+#include "mmio.h"
+
+#define HUD_BANNERS (HUD_WIDGET_COUNT - HUD_FIRST_BANNER)
+#define HUD_SAVE_W (HUD_TEXT_MAX * 8 + 2 * HUD_BANNER_PAD)
+
+static HudWidget widgets[HUD_WIDGET_COUNT];
+
+static int bar_y, bar_h;
+static uint8_t bar_bg;
+static int bar_dirty = 0;
+
+// Board pixels under each drawn banner, with the box they came from
+typedef struct {
+    int16_t x, y, w, h;
+    uint8_t valid;
+    uint8_t pixels[HUD_SAVE_W * HUD_BANNER_H];
+} SaveUnder;
+
+static SaveUnder saved[HUD_BANNERS];
+
+static int is_banner(HudId id) {
+    return id >= HUD_FIRST_BANNER;
+}
+
+static int text_equal(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+static void text_copy(char *dst, const char *src) {
+    int n = 0;
+    while (src[n] && n < HUD_TEXT_MAX) {
+        dst[n] = src[n];
+        n++;
+    }
+    dst[n] = '\0';
+}
+
+static int text_length(const char *text) {
+    int n = 0;
+    while (text[n]) n++;
+    return n;
+}
+
+static int overlaps(const HudWidget *w, int x, int y, int width, int height) {
+    return x < w->x + w->w && w->x < x + width && y < w->y + w->h && w->y < y + height;
+}
+
+void hud_reset(void) {
+    for (int i = 0; i < HUD_WIDGET_COUNT; i++) {
+        widgets[i].w = 0;
+        widgets[i].visible = 0;
+        widgets[i].drawn = 1;       // Nothing on screen and nothing wanted
+        widgets[i].text[0] = '\0';
+    }
+    for (int i = 0; i < HUD_BANNERS; i++) saved[i].valid = 0;
+    bar_h = 0;
+    bar_dirty = 0;
+}
+
+void hud_bar(int y, int h, uint8_t bg) {
+    bar_y = y;
+    bar_h = h;
+    bar_bg = bg;
+    bar_dirty = 1;
+}
+
+void hud_place(HudId id, int x, int w, uint8_t fg) {
+    HudWidget *wd = &widgets[id];
+    wd->x = (int16_t)x;
+    wd->y = (int16_t)(bar_y + (bar_h - HUD_BAR_H) / 2);
+    wd->w = (int16_t)w;
+    wd->h = HUD_BAR_H;
+    wd->fg = fg;
+    wd->bg = bar_bg;
+    wd->drawn = 0;
+}
+
+void hud_set_text(HudId id, const char *text) {
+    HudWidget *w = &widgets[id];
+    if (w->visible && text_equal(w->text, text)) return;
+    text_copy(w->text, text);
+    w->visible = 1;
+    w->drawn = 0;
+}
+
+// "LABEL 123", formatted here since there is no printf on the board
+void hud_set_number(HudId id, const char *label, int value) {
+    char buf[HUD_TEXT_MAX + 1];
+    int n = 0;
+    while (label[n] && n < HUD_TEXT_MAX - 12) {
+        buf[n] = label[n];
+        n++;
+    }
+    buf[n++] = ' ';
+    if (value < 0) {
+        buf[n++] = '-';     // The font has no minus, the glyph is skipped but keeps its place
+        value = -value;
+    }
+    char digits[10];
+    int d = 0;
+    do {
+        digits[d++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (d > 0) buf[n++] = digits[--d];
+    buf[n] = '\0';
+    hud_set_text(id, buf);
+}
+
+void hud_banner(HudId id, int y, const char *text, uint8_t fg, uint8_t bg) {
+    HudWidget *w = &widgets[id];
+    if (w->visible && w->y == y && w->fg == fg && w->bg == bg && text_equal(w->text, text)) return;
+    text_copy(w->text, text);
+    w->w = (int16_t)(text_length(w->text) * 8 + 2 * HUD_BANNER_PAD);
+    w->h = HUD_BANNER_H;
+    w->x = (int16_t)((SCREEN_W - w->w) / 2);
+    w->y = (int16_t)y;
+    w->fg = fg;
+    w->bg = bg;
+    w->visible = 1;
+    w->drawn = 0;
+}
+
+void hud_hide(HudId id) {
+    HudWidget *w = &widgets[id];
+    if (!w->visible) return;
+    w->visible = 0;
+    w->drawn = 0;
+}
+
+int hud_visible(HudId id) {
+    return widgets[id].visible;
+}
+
+// Copy the screen under a banner box into its save slot, clipped to the screen
+static void save_under(SaveUnder *s, const HudWidget *w) {
+    s->x = w->x;
+    s->y = w->y;
+    s->w = w->w;
+    s->h = w->h;
+    for (int dy = 0; dy < s->h; dy++) {
+        int y = s->y + dy;
+        if (y < 0 || y >= SCREEN_H) continue;
+        for (int dx = 0; dx < s->w; dx++) {
+            int x = s->x + dx;
+            if (x < 0 || x >= SCREEN_W) continue;
+            s->pixels[dy * HUD_SAVE_W + dx] = fb_read(y * SCREEN_W + x);
+        }
+    }
+    s->valid = 1;
+}
+
+static void restore_under(SaveUnder *s) {
+    if (!s->valid) return;
+    for (int dy = 0; dy < s->h; dy++) {
+        int y = s->y + dy;
+        if (y < 0 || y >= SCREEN_H) continue;
+        for (int dx = 0; dx < s->w; dx++) {
+            int x = s->x + dx;
+            if (x < 0 || x >= SCREEN_W) continue;
+            fb_write(y * SCREEN_W + x, s->pixels[dy * HUD_SAVE_W + dx]);
+        }
+    }
+    s->valid = 0;
+}
+
+void hud_lift(void) {
+    for (int i = HUD_WIDGET_COUNT - 1; i >= HUD_FIRST_BANNER; i--) {     // Reverse order, overlaps unwind
+        restore_under(&saved[i - HUD_FIRST_BANNER]);
+        if (widgets[i].visible) widgets[i].drawn = 0;
+    }
+}
+
+int hud_draw(void) {
+    int drawn = 0;
+
+    if (bar_dirty && bar_h > 0) {
+        dl_rect(0, bar_y, SCREEN_W, bar_h, bar_bg);
+        for (int i = 0; i < HUD_FIRST_BANNER; i++) widgets[i].drawn = 0;
+        drawn++;
+    }
+    bar_dirty = 0;
+
+    // Banners changing or going away put their old pixels back first, newest first
+    for (int i = HUD_WIDGET_COUNT - 1; i >= HUD_FIRST_BANNER; i--) {
+        SaveUnder *s = &saved[i - HUD_FIRST_BANNER];
+        if (widgets[i].drawn || !s->valid) continue;
+        restore_under(s);
+        drawn++;
+    }
+
+    for (int i = 0; i < HUD_WIDGET_COUNT; i++) {
+        HudWidget *w = &widgets[i];
+        if (w->drawn) continue;
+        w->drawn = 1;
+        if (is_banner((HudId)i)) {
+            if (!w->visible) continue;      // Gone, restored above
+            save_under(&saved[i - HUD_FIRST_BANNER], w);
+        }
+        int pad = is_banner((HudId)i) ? HUD_BANNER_PAD : HUD_BAR_PAD;
+        dl_rect(w->x, w->y, w->w, w->h, w->bg);     // A hidden bar widget is just cleared
+        if (w->visible) dl_text(w->x + pad, w->y + pad, w->text, w->fg);
+        drawn++;
+    }
+
+    if (drawn) dl_flush();
+    return drawn;
+}
+
+void hud_damage(int x, int y, int w, int h) {
+    if (bar_h > 0 && y < bar_y + bar_h && bar_y < y + h) bar_dirty = 1;
+    for (int i = HUD_FIRST_BANNER; i < HUD_WIDGET_COUNT; i++) {
+        if (widgets[i].drawn && overlaps(&widgets[i], x, y, w, h)) widgets[i].drawn = 0;
+    }
+}
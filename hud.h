@@ -0,0 +1,54 @@
+// Zunjee, Karen, retained HUD: status bar widgets and banners that redraw only when their content changes
+#ifndef HUD_H
+#define HUD_H
+
+#include <stdint.h>
+
+#define HUD_TEXT_MAX 24             // Characters per widget
+#define HUD_BAR_PAD 1               // Pixels around the text of a status bar widget
+#define HUD_BANNER_PAD 4            // and of a banner
+#define HUD_BAR_H (8 + 2 * HUD_BAR_PAD)
+#define HUD_BANNER_H (8 + 2 * HUD_BANNER_PAD)
+
+// Named widgets, the games place the ones they use
+typedef enum {
+    HUD_STATUS,         // Status bar, left: level or difficulty
+    HUD_COUNT_A,        // Status bar counters
+    HUD_COUNT_B,
+    HUD_BANNER,         // Over the board: end of game, notices
+    HUD_BANNER_SUB,     // Second banner line, below HUD_BANNER
+    HUD_WIDGET_COUNT
+} HudId;
+
+#define HUD_FIRST_BANNER HUD_BANNER
+
+// One widget, the box is fixed for bar widgets and follows the text for banners
+typedef struct {
+    int16_t x, y, w, h;
+    uint8_t fg, bg;
+    uint8_t visible;            // Wanted on screen
+    uint8_t drawn;              // On screen as it is described here
+    char text[HUD_TEXT_MAX + 1];
+} HudWidget;
+
+// Forget everything on screen, call when a game starts over on a cleared screen
+void hud_reset(void);
+
+// Status bar: a strip the board never draws into, painted by the next hud_draw
+void hud_bar(int y, int h, uint8_t bg);
+void hud_place(HudId id, int x, int w, uint8_t fg);
+
+// Content, setting what is already shown costs nothing
+void hud_set_text(HudId id, const char *text);
+void hud_set_number(HudId id, const char *label, int value);
+void hud_banner(HudId id, int y, const char *text, uint8_t fg, uint8_t bg);   // Centered
+void hud_hide(HudId id);
+int hud_visible(HudId id);
+
+// Board redraws are bracketed by these: lift puts the pixels under banners back,
+// draw saves them again and draws every widget whose content or pixels changed
+void hud_lift(void);
+int hud_draw(void);     // Widgets drawn, 0 means the screen is unchanged
+void hud_damage(int x, int y, int w, int h);    // Something else drew over this area
+
+#endif
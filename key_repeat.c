@@ -0,0 +1,31 @@
+// Zunjee, Karen, KEY1 hold-to-repeat, every event comes out of the same poll as a plain press
+#include "key_repeat.h"
+#include "timer.h"
+
+void key_repeat_init(KeyRepeat *kr, int down) {
+    kr->down = down;
+    kr->next_ms = timer_ms() + KEY_REPEAT_DELAY_MS;
+    kr->gap_ms = KEY_REPEAT_FIRST_MS;
+}
+
+KeyEvent key_repeat_poll(KeyRepeat *kr, int down, int can_repeat) {
+    uint32_t now = timer_ms();
+    KeyEvent event = KEY_EVENT_NONE;
+
+    if (down && !kr->down) {
+        event = KEY_EVENT_PRESS;
+        kr->next_ms = now + KEY_REPEAT_DELAY_MS;
+        kr->gap_ms = KEY_REPEAT_FIRST_MS;
+    } else if (down && !can_repeat) {
+        kr->next_ms = now + KEY_REPEAT_DELAY_MS;
+        kr->gap_ms = KEY_REPEAT_FIRST_MS;
+    } else if (down && (int32_t)(now - kr->next_ms) >= 0) {
+        event = KEY_EVENT_REPEAT;
+        kr->next_ms = now + kr->gap_ms;     // From now, a slow frame does not cause a burst
+        kr->gap_ms = kr->gap_ms * 3 / 4;
+        if (kr->gap_ms < KEY_REPEAT_MIN_MS) kr->gap_ms = KEY_REPEAT_MIN_MS;
+    }
+
+    kr->down = down;
+    return event;
+}
@@ -0,0 +1,34 @@
+// Zunjee, Karen, KEY1 press edges plus hold-to-repeat with acceleration, timed by timer.h
+#ifndef KEY_REPEAT_H
+#define KEY_REPEAT_H
+
+#include <stdint.h>
+#include "dtekv_board.h"
+
+#define KEY_REPEAT_DELAY_MS 400     // Held this long before the first repeat
+#define KEY_REPEAT_FIRST_MS 160     // Gap before the second repeat, each later gap is 3/4 of the last
+#define KEY_REPEAT_MIN_MS 40        // down to this
+
+typedef enum {
+    KEY_EVENT_NONE,
+    KEY_EVENT_PRESS,        // KEY1 went down
+    KEY_EVENT_REPEAT        // Still down and a repeat is due
+} KeyEvent;
+
+typedef struct {
+    int down;               // KEY1 down at the last poll
+    uint32_t next_ms;       // When the next repeat is due
+    uint32_t gap_ms;        // Gap after it
+} KeyRepeat;
+
+// KEY1 reads 0 while pressed
+static inline int key1_down(uint32_t keys) {
+    return !(keys & (1u << KEY_enter));
+}
+
+void key_repeat_init(KeyRepeat *kr, int down);     // A key already down at start is not a press
+// Poll once per loop turn; can_repeat says whether the held action repeats (a direction
+// switch is on), while it does not the repeat delay starts over
+KeyEvent key_repeat_poll(KeyRepeat *kr, int down, int can_repeat);
+
+#endif
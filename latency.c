@@ -0,0 +1,113 @@
+// Zunjee, Karen, input-to-photon latency histograms, HEX readout and on-screen table
+#include "latency.h"
+
+#ifdef PROFILE
+
+#include "profile.h"
+#include "dtekv_board.h"
+#include "mmio.h"
+#include "sudoku_vga.h"
+
+static LatHist hists[LAT_ACTION_COUNT];
+
+// Measurement waiting for its frame, a newer KEY1 edge replaces it
+static int pending = 0;
+static LatAction pending_action;
+static uint32_t pending_start;
+
+// Two-letter labels, same order as LatAction
+static const char *action_labels[LAT_ACTION_COUNT] = {
+    "MV", "RV", "FL", "DG", "ER", "MN"
+};
+
+// Seven-segment patterns for 0-9, segments are active-low
+static const uint8_t hex_digits[10] = {
+    0xC0, 0xF9, 0xA4, 0xB0, 0x99, 0x92, 0x82, 0xF8, 0x80, 0x90
+};
+#define HEX_BLANK 0xFF
+
+// HEX5 = action number, HEX3-HEX0 = latency in ms, clamped to 9999
+static void hex_show(LatAction action, uint32_t cycles) {
+    uint32_t ms = cycles / LAT_CYCLES_PER_MS;
+    if (ms > 9999) ms = 9999;
+    mmio_hex_write(5, hex_digits[action]);
+    mmio_hex_write(4, HEX_BLANK);
+    for (int d = 0; d < 4; d++) {
+        mmio_hex_write(d, (d > 0 && ms == 0) ? HEX_BLANK : hex_digits[ms % 10]);
+        ms /= 10;
+    }
+}
+
+static int bucket_of(uint32_t cycles) {
+    uint32_t ms = cycles / LAT_CYCLES_PER_MS;
+    int b = 0;
+    while (ms > 0 && b < LAT_BUCKETS - 1) {
+        ms >>= 1;
+        b++;
+    }
+    return b;
+}
+
+void lat_input(LatAction action) {
+    pending = 1;
+    pending_action = action;
+    pending_start = read_mcycle();
+}
+
+void lat_presented(void) {
+    if (!pending) return;
+    uint32_t cycles = read_mcycle() - pending_start;   // Unsigned subtraction handles wrap
+    LatHist *h = &hists[pending_action];
+    pending = 0;
+
+    if (h->count == 0 || cycles < h->min_cycles) h->min_cycles = cycles;
+    if (cycles > h->max_cycles) h->max_cycles = cycles;
+    h->last_cycles = cycles;
+    h->sum_us += cycles / (LAT_CPU_HZ / 1000000);
+    h->buckets[bucket_of(cycles)]++;
+    h->count++;
+
+    hex_show(pending_action, cycles);
+}
+
+const LatHist *lat_hist(LatAction action) {
+    return &hists[action];
+}
+
+const char *lat_label(LatAction action) {
+    return action_labels[action];
+}
+
+// Write a value as 4 right-aligned digits, clamped to 9999
+static void format4(char *buf, uint32_t v) {
+    if (v > 9999) v = 9999;
+    for (int i = 3; i >= 0; i--) {
+        buf[i] = (i < 3 && v == 0) ? ' ' : (char)('0' + v % 10);
+        v /= 10;
+    }
+}
+
+// Table layout: one row per action, "LL NNNN AAAA XXXX" = count, avg and max in ms, bottom-right corner
+#define LAT_OVERLAY_W (17 * 8)
+#define LAT_OVERLAY_X (SCREEN_W - LAT_OVERLAY_W)
+#define LAT_OVERLAY_Y (SCREEN_H - 8 * LAT_ACTION_COUNT)
+
+void lat_draw_overlay(void) {
+    draw_rect(LAT_OVERLAY_X, LAT_OVERLAY_Y, LAT_OVERLAY_W, 8 * LAT_ACTION_COUNT, black);
+
+    for (int a = 0; a < LAT_ACTION_COUNT; a++) {
+        const LatHist *h = &hists[a];
+        char line[18];
+        for (int i = 0; i < 17; i++) line[i] = ' ';
+        line[0] = action_labels[a][0];
+        line[1] = action_labels[a][1];
+        format4(&line[3], h->count);
+        format4(&line[8], h->count ? h->sum_us / h->count / 1000 : 0);
+        format4(&line[13], h->max_cycles / LAT_CYCLES_PER_MS);
+        line[17] = '\0';
+
+        draw_text(LAT_OVERLAY_X, LAT_OVERLAY_Y + a * 8, line, h->count ? white : gray);
+    }
+}
+
+#endif
@@ -0,0 +1,48 @@
+// Zunjee, Karen, input-to-photon latency: KEY1 edge to the frame handed to the VGA DMA
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+// Compiled in with -DPROFILE like the profiling zones, release builds get empty macros
+
+// What the KEY1 press did, one histogram each
+typedef enum {
+    LAT_MOVE,       // Cursor move in either game
+    LAT_REVEAL,     // Minesweeper reveal
+    LAT_FLAG,       // Minesweeper flag
+    LAT_DIGIT,      // Sudoku digit cycle
+    LAT_ERASE,      // Sudoku erase
+    LAT_MENU,       // Menu move, pick and back
+    LAT_ACTION_COUNT
+} LatAction;
+
+#define LAT_CPU_HZ 30000000     // DTEK-V clock, turns mcycle deltas into time
+#define LAT_CYCLES_PER_MS (LAT_CPU_HZ / 1000)
+#define LAT_BUCKETS 12          // Bucket 0 is under 1 ms, bucket k >= 1 starts at 2^(k-1) ms, the last is open ended
+
+// Latencies of one action
+typedef struct {
+    uint32_t count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t last_cycles;
+    uint32_t sum_us;            // Microseconds so the average needs no 64-bit division
+    uint32_t buckets[LAT_BUCKETS];
+} LatHist;
+
+#ifdef PROFILE
+void lat_input(LatAction action);   // KEY1 edge handled, the next present closes the measurement
+void lat_presented(void);           // Frame handed to the VGA DMA
+const LatHist *lat_hist(LatAction action);
+const char *lat_label(LatAction action);
+void lat_draw_overlay(void);
+
+#define LAT_INPUT(action) lat_input(action)
+#define LAT_PRESENTED()   lat_presented()
+#else
+#define LAT_INPUT(action) ((void)0)
+#define LAT_PRESENTED()   ((void)0)
+#endif
+
+#endif
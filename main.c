@@ -1,38 +1,28 @@
 // Zunjee, Karen main program file
 #include "main_menu.h"
 #include "sudoku.h"
+#include "timer.h"
+#include "sched.h"
+#include "game_pool.h"
 
-int main() {
-    init_main_menu();
-    int last_selection = -1; // To track last selection for redraw optimization, -1 means none
-
-    while(1) {  
-        switch(menu_state) {    
-            case MENU_STATE_MAIN:   
-                if (game_selection != last_selection) {     // Only redraw if selection changed
-                    draw_main_menu(game_selection);         // Draw menu with current selection
-                    last_selection = game_selection;        // Update last selection
-                }
-                menu_state = handle_menu_input();   // Check for menu input
-                delay(1);     
-                break;
+// Screens by menu state, each ticked by the scheduler until it returns another one
+static const SchedState states[] = {
+    [MENU_STATE_MAIN]       = { menu_enter, menu_update, menu_render, TRANSITION_FADE },
+    [MENU_STATE_MINEWEEPER] = { minesweeper_enter, minesweeper_update, minesweeper_render, TRANSITION_DISSOLVE },
+    [MENU_STATE_SUDOKU]     = { sudoku_screen_enter, sudoku_screen_update, sudoku_screen_render, TRANSITION_WIPE },
+};
 
-            case MENU_STATE_MINEWEEPER:     // Run minesweeper game
-                run_minesweeper();      // After game ends, return to menu
-                last_selection = -1; // Reset so menu redraws after returning
-                break;
-
-            case MENU_STATE_SUDOKU:     // Run sudoku game
-                run_sudoku();       // After game ends, return to menu
-                last_selection = -1; // Reset so menu redraws after returning
-                break;
-        }
-    }
+int main() {
+    timer_start();      // Scheduler ticks and input repeat timing
+    sched_add_idle(pool_idle);      // Next games are prepared while the player is in the menu
+    sched_run(states, MENU_STATE_MAIN);
 
     return 0;
 }
 
 void handle_interrupt(void) {   
     // Basic interrupt handler
+#ifdef __riscv
     asm volatile("mret");
+#endif
 }
\ No newline at end of file
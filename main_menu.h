@@ -11,30 +11,44 @@
 #include "minesweeper.h"
 
 
-SudokuDifficulty get_selected_difficulty_from_switches(void);
-
 // Menu states
 #define MENU_STATE_MAIN 0
 #define MENU_STATE_MINEWEEPER 1
 #define MENU_STATE_SUDOKU 2
 
-// Menu selection
-#define MENU_MINEWEEPER 0
-#define MENU_SUDOKU 1
+// What the menu pages chose, kept between games so the menu comes back on the last pick
+typedef enum {
+    MENU_CHOICE_GAME,       // MENU_STATE_MINEWEEPER or MENU_STATE_SUDOKU
+    MENU_CHOICE_LEVEL,      // MsLevel or SudokuDifficulty
+    MENU_CHOICE_VARIANT,    // MsTopology or SudokuOrder
+    MENU_CHOICE_COUNT
+} MenuChoice;
+
+extern int menu_choice[MENU_CHOICE_COUNT];
+extern unsigned menu_seed;      // Mixed with the inputs every menu tick, seeds the next game
+
+// Puzzle IDs (sudoku.h, minesweeper.h): with the level they give the same board again
+#define SW_ID_DIGIT 0xF         // SW0-SW3, the hex digit SW9 + KEY1 shifts into the ID in the menu
+extern uint32_t menu_puzzle_id; // Last puzzle played, or the one typed in to replay
+extern int menu_replay;         // The next game plays menu_puzzle_id instead of a new puzzle
 
-// Switch assignments for menu
-#define SW_SELECT_GAME 0  // Use switch 0 to select between games
+// ID of the game being started: the one to replay, else fresh. The menu shows it afterwards.
+uint32_t menu_take_puzzle_id(uint32_t fresh);
 
-// Function declarations
 void init_main_menu(void);
-void draw_main_menu(int selection);
-int handle_menu_input(void);
-void run_minesweeper(void);
-void run_sudoku(void);
-void delay(int ms);
+MsLevel menu_minesweeper_level(void);
+MsTopology menu_minesweeper_topology(void);
+SudokuDifficulty menu_sudoku_difficulty(void);
+SudokuOrder menu_sudoku_order(void);
+
+// Scheduler states (sched.h), Minesweeper's are in minesweeper.h
+void menu_enter(void);
+int menu_update(void);
+void menu_render(void);
+void sudoku_screen_enter(void);     // Named apart from sudoku_update, the game logic step
+int sudoku_screen_update(void);
+void sudoku_screen_render(void);
 
-// Global variables
-extern int menu_state;
-extern int game_selection;
+void delay(int ms);
 
 #endif
\ No newline at end of file
@@ -6,15 +6,16 @@
 #include "sudoku_puzzles.h"
 #include "sudoku_vga.h"
 #include"sudoku.h"
-
-// VGA Memory Addresses extern because they are defined in sudoku_vga.c
-extern volatile char *VGA;  
-extern volatile int  *VGA_ctrl; 
-extern volatile int  *SWITCHES;
-extern volatile int  *keys1;
-
-int menu_state = MENU_STATE_MAIN;
-int game_selection = MENU_MINEWEEPER;
+#include "profile.h"
+#include "latency.h"
+#include "game_pool.h"
+#include "arena.h"
+#include "assets.h"
+#include "sudoku_hint.h"
+#include "art.h"
+#include "menu_engine.h"
+#include "key_repeat.h"
+#include "mmio.h"
 
 // Map ASCII letters to font array index 0-25 (A-Z)
 int font_index(char c) {
@@ -24,11 +25,17 @@ int font_index(char c) {
 }
 
 void draw_char(int x, int y, char c, unsigned char color) {    // Draw a single character at (x, y)
-    if (c < 'A' || c > 'Z') return;     
+    const unsigned char *glyph;
+    if (c >= 'A' && c <= 'Z') {
+        glyph = font8x8_AZ[font_index(c)];  // Get bitmap in letter font
+    } else if (c >= '0' && c <= '9') {
+        glyph = font8x8_09[c - '0'];        // Digits have their own font
+    } else {
+        return;
+    }
 
-    int index = font_index(c);     // Get index in font array
     for (int row = 0; row < 8; row++) {   // Each character is 8 pixels tall
-        unsigned char row_data = font8x8_AZ[index][row];    // Get bitmap for this row
+        unsigned char row_data = glyph[row];    // Get bitmap for this row
         for (int col = 0; col < 8; ++col) {     // Each character is 8 pixels wide
             if (row_data & (1 << (7 - col))) { // Check if the bit is set
                 draw_pixel(x + col, y + row, color);    // Draw pixel if bit is 1
@@ -50,202 +57,259 @@ void draw_text(int x, int y, const char *text, unsigned char color) {   // Draw
     }
 }
 
-//Initliazlised menu statment
-void init_main_menu(void) {
-    menu_state = MENU_STATE_MAIN;
-    game_selection = MENU_MINEWEEPER;
+// Menu pages: game, then Minesweeper level and board shape or Sudoku difficulty and grid size.
+// A page is a table, a new game or level is one more line here
+static const MenuItem ms_board_items[] = {
+    { "SQUARE", MS_TOPO_SQUARE, 0 },
+    { "TORUS", MS_TOPO_TORUS, 0 },
+    { "HEX", MS_TOPO_HEX, 0 },
+};
+static const MenuPage ms_board_page = { "BOARD", MENU_CHOICE_VARIANT, 3, ms_board_items };
+
+static const MenuItem ms_level_items[] = {
+    { "EASY", MS_EASY, &ms_board_page },
+    { "MEDIUM", MS_MEDIUM, &ms_board_page },
+    { "HARD", MS_HARD, &ms_board_page },
+    { "HUGE 100X100", MS_HUGE, &ms_board_page },
+    { "GIANT 256X256", MS_GIANT, &ms_board_page },
+};
+static const MenuPage ms_level_page = { "LEVEL", MENU_CHOICE_LEVEL, 5, ms_level_items };
+
+static const MenuItem sudoku_grid_items[] = {
+    { "4X4", SUDOKU_4X4, 0 },
+    { "9X9", SUDOKU_9X9, 0 },
+    { "16X16", SUDOKU_16X16, 0 },
+};
+static const MenuPage sudoku_grid_page = { "GRID SIZE", MENU_CHOICE_VARIANT, 3, sudoku_grid_items };
+
+static const MenuItem sudoku_difficulty_items[] = {
+    { "EASY", EASY, &sudoku_grid_page },
+    { "MEDIUM", MEDIUM, &sudoku_grid_page },
+    { "HARD", HARD, &sudoku_grid_page },
+};
+static const MenuPage sudoku_difficulty_page = { "DIFFICULTY", MENU_CHOICE_LEVEL, 3, sudoku_difficulty_items };
+
+static const MenuItem game_items[] = {
+    { "MINESWEEPER", MENU_STATE_MINEWEEPER, &ms_level_page },
+    { "SUDOKU", MENU_STATE_SUDOKU, &sudoku_difficulty_page },
+};
+static const MenuPage game_page = { "SELECT GAME", MENU_CHOICE_GAME, 2, game_items };
+
+int menu_choice[MENU_CHOICE_COUNT] = { MENU_STATE_MINEWEEPER, EASY, SUDOKU_9X9 };
+unsigned menu_seed = 0x6D2B79F5u;  // Initial arbitrary seed for RNG, mixed with entropy every menu tick
+
+uint32_t menu_puzzle_id;
+int menu_replay;
+
+static Menu menu;
+static KeyRepeat menu_key;
+static int id_known;            // A game was played or an ID typed, menu_puzzle_id is worth showing
+static char id_text[19];        // "REPLAY ID 1A2B3C4D" or "LAST ID 1A2B3C4D"
+
+// Status line: the ID the next game replays, else the last one played
+static void show_puzzle_id(void) {
+    static const char hex[] = "0123456789ABCDEF";
+    if (!id_known) return;
+    const char *label = menu_replay ? "REPLAY ID " : "LAST ID ";
+    int n = 0;
+    while (*label) id_text[n++] = *label++;
+    for (int shift = 28; shift >= 0; shift -= 4) id_text[n++] = hex[(menu_puzzle_id >> shift) & 0xF];
+    id_text[n] = '\0';
+    menu_status(&menu, id_text, menu_replay ? yellow : white);
 }
 
-// Draw the main menu with current selection highlighted
-void draw_main_menu(int selection) {
-    // Clear screen with background color
-    draw_rect(0, 0, 320, 240, light_blue);
-
-    // Draw selection box
-    int box_y = 100 + (selection * 60);
-    draw_rect(80, box_y, 160, 40, yellow);
-    
-    // Draw Minesweeper option
-    draw_rect(85, 105, 150, 30, game_selection == MENU_MINEWEEPER ? white : gray);
-    
-    // Draw Sudoku option  
-    draw_rect(85, 165, 150, 30, game_selection == MENU_SUDOKU ? white : gray);
-    
-    // Draw title text
-    draw_text(100, 115, "MINESWEEPER", black);
-    draw_text(130, 175, "SUDOKU", black);
-    
-    // Draw select game instruction
-    draw_text(116, 20, "SELECT GAME", pink); 
-
-    *VGA_ctrl = 1; // Kick DMA to update screen
+void init_main_menu(void) {
+    menu_open(&menu, &game_page, menu_choice, &art_menu_bg);
+    show_puzzle_id();
 }
 
-int handle_menu_input(void) {
-    int current_switches = *SWITCHES;
-    int current_keys     = *keys1;
-
-    static int last_switches;   // For edge detection
-    static int last_keys;      
-    static int seeded = 0;
-
-    // Seed previous state on first call to avoid a false/missed edge
-    if (!seeded) {
-        last_switches = current_switches;
-        last_keys     = current_keys;
-        seeded        = 1;
-    }
+uint32_t menu_take_puzzle_id(uint32_t fresh) {
+    if (!menu_replay) menu_puzzle_id = fresh;
+    menu_replay = 0;
+    id_known = 1;
+    return menu_puzzle_id;
+}
 
-    // SW0 selects which game is highlighted
-    if (current_switches & (1 << SW_SELECT_GAME)) {
-        game_selection = MENU_SUDOKU;   // SW0 = 1 selects Sudoku
-    } else {
-        game_selection = MENU_MINEWEEPER;   // SW0 = 0 selects Minesweeper
-    }
+MsLevel menu_minesweeper_level(void) {
+    return (MsLevel)menu_choice[MENU_CHOICE_LEVEL];
+}
 
-    // KEY1 (KEY_enter) is active-low: pressed = 0, released = 1 
-    {
-        int prev_bit = (last_keys    >> KEY_enter) & 1;
-        int curr_bit = (current_keys >> KEY_enter) & 1;
-        int press_edge = (prev_bit == 1) && (curr_bit == 0);
-
-        if (press_edge) {      // On KEY1 press
-            last_switches = current_switches;   // Update previous state in order to avoid multi-fire
-            last_keys     = current_keys;       
-
-            if (game_selection == MENU_MINEWEEPER) {
-                return MENU_STATE_MINEWEEPER;   // Start minesweeper
-            } else {
-                return MENU_STATE_SUDOKU;       // Start sudoku
-            }
-        }
-    }
+MsTopology menu_minesweeper_topology(void) {
+    return (MsTopology)menu_choice[MENU_CHOICE_VARIANT];
+}
 
-    last_switches = current_switches;  
-    last_keys     = current_keys;
+SudokuDifficulty menu_sudoku_difficulty(void) {
+    return (SudokuDifficulty)menu_choice[MENU_CHOICE_LEVEL];
+}
 
-    return MENU_STATE_MAIN; 
+SudokuOrder menu_sudoku_order(void) {
+    return (SudokuOrder)menu_choice[MENU_CHOICE_VARIANT];
 }
 
-void run_minesweeper(void) {
-    // Initialize and run minesweeper game
-    minesweeper();
+// Main menu screen: back on the game page after a game, with the last choices highlighted
+void menu_enter(void) {
+    arena_reset(&session_arena);    // Whatever the last game allocated
+    init_main_menu();
+    key_repeat_init(&menu_key, key1_down(mmio_keys()));     // KEY1 may still be down from the game
 }
 
-void run_sudoku(void) {
-    SudokuGame game;
-
-    volatile int *keys = (volatile int *) KEY1_base;    
-    volatile int *SWITCHES = (volatile int *) SWITCH_base;  
-    const int KEY_MASK = (1 << KEY_enter);  // KEY1 mask, active-low
-    int prev_keys = *keys;                  
-    unsigned seed = 0x6D2B79F5u;    // Initial arbitrary seed for RNG, will be mixed with entropy
-
-    while (1) { // Wait for KEY1 press to start
-        int curr = *keys;   // Current key state
-
-        // Entropy for RNG seeding, ensures different puzzle each time 
-        seed ^= (seed << 13);   
-        seed ^= (seed >> 17);
-        seed ^= (seed << 5);
-        seed ^= (unsigned)curr;
-        seed ^= ((unsigned)SWITCHES << 16); 
-
-        // KEY1 edge detection (active-low)
-        int was_pressed = !(prev_keys & KEY_MASK);  // Previously pressed
-        int is_pressed  = !(curr      & KEY_MASK);  // Currently pressed
-        int key1_press_edge = (!was_pressed && is_pressed); // Rising edge detection
-
-        if (key1_press_edge) {      // On KEY1 press
-            prev_keys = curr;       // Update previous state
-            break; 
-        }
-        prev_keys = curr;   // Update previous state
-        delay(5);     
+// SW4/SW5 with KEY1 move the highlight (held KEY1 repeats), SW8 with KEY1 goes back, KEY1 alone picks.
+// SW9 with KEY1 shifts the hex digit on SW0-SW3 into the ID to replay, SW8+SW9 replays the last one.
+int menu_update(void) {
+    // Entropy for RNG seeding, ensures different puzzle each time
+    menu_seed ^= (menu_seed << 13);
+    menu_seed ^= (menu_seed >> 17);
+    menu_seed ^= (menu_seed << 5);
+    uint32_t keys = mmio_keys();
+    uint32_t switches = mmio_switches();
+    menu_seed ^= keys;
+    menu_seed ^= switches << 16;
+
+    int moving = (switches & ((1 << SW_up) | (1 << SW_down))) != 0;
+    if (key_repeat_poll(&menu_key, key1_down(keys), moving) == KEY_EVENT_NONE) return MENU_STATE_MAIN;
+
+    LAT_INPUT(LAT_MENU);    // Measured to the next menu or first board frame
+    if (switches & (1 << SW_up)) {
+        menu_move(&menu, -1);
+    } else if (switches & (1 << SW_down)) {
+        menu_move(&menu, 1);
+    } else if ((switches & (1 << SW_ACTION_1)) && (switches & (1 << SW_ACTION_2))) {
+        menu_replay = !menu_replay && id_known;     // Replay the last puzzle, or play a new one after all
+        show_puzzle_id();
+    } else if (switches & (1 << SW_ACTION_2)) {
+        if (!menu_replay) menu_puzzle_id = 0;       // First digit of a new ID
+        menu_puzzle_id = (menu_puzzle_id << 4) | (switches & SW_ID_DIGIT);
+        menu_replay = id_known = 1;
+        show_puzzle_id();
+    } else if (switches & (1 << SW_ACTION_1)) {
+        menu_back(&menu);
+    } else if (menu_pick(&menu)) {
+        return menu_choice[MENU_CHOICE_GAME];
     }
+    return MENU_STATE_MAIN;
+}
 
-    // Seed RNG here so each Sudoku game is random 
-    srand(seed); 
-
-    // Difficulty selection
-    SudokuDifficulty difficulty = get_selected_difficulty_from_switches();  // Read switches to get difficulty
-    sudoku_init(&game, difficulty); // Initialize game state
-
-    // Initial draw
-    sudoku_render_vga(&game);
+void menu_render(void) {
+    if (menu_draw(&menu)) vga_present();
+}
 
-    // Track visible state to avoid unnecessary redraws, only redraw on changes 
-    uint32_t last_sig = // Pack key state and game state into a single integer, used to detect changes
-        (uint32_t)game.selected_col |
-        ((uint32_t)game.selected_row << 8) |
-        ((uint32_t)game.state        << 16);
+// Sudoku screen: plays, waits for the check press, then for the way out
+typedef enum {
+    SUDOKU_PLAYING,
+    SUDOKU_WAIT_CHECK,
+    SUDOKU_WAIT_EXIT
+} SudokuPhase;
+
+#define SUDOKU_REDRAW_CURSOR 1
+#define SUDOKU_REDRAW_FULL 2
+#define SUDOKU_REDRAW_NOTES 3
+
+static SudokuGame *game;          // In the session arena, from sudoku_screen_enter to the menu
+static SudokuPhase phase;
+static int prev_keys;
+static int redraw;
+static uint16_t old_notes;
+
+// KEY1 press edge for the waiting phases, KEY1 is active-low
+static int key1_pressed(void) {
+    int curr = (int)mmio_keys();
+    int was_pressed = !(prev_keys & (1 << KEY_enter));
+    int is_pressed  = !(curr & (1 << KEY_enter));
+    prev_keys = curr;
+    return !was_pressed && is_pressed;
+}
 
-    // Game loop
-    for (;;) {
-    InputAction action = get_input_vga();
+_Static_assert(ARENA_ROUND(sizeof(SudokuGame)) <= SESSION_ARENA_BYTES, "Sudoku game does not fit the session arena");
+
+// Difficulty and size come from the menu, the puzzle comes ready from the pool when it can. A new
+// puzzle takes the pool's base and a symmetry from the menu's entropy, a replayed one its own ID.
+static void sudoku_start(void) {
+    SudokuDifficulty difficulty = menu_sudoku_difficulty();
+    SudokuOrder order = menu_sudoku_order();
+    int base = sudoku_pool_base(difficulty, order);
+    uint32_t id = menu_take_puzzle_id(SUDOKU_ID(base >= 0 ? (unsigned)base : menu_seed, menu_seed >> 16));
+    if (sudoku_pool_take(game, difficulty, order, SUDOKU_ID_BASE(id))) {
+        PROF_SCOPE(PROF_SUDOKU_INIT) sudoku_transform(game, SUDOKU_ID_VARIANT(id));
+    } else {
+        sudoku_generate(game, difficulty, order, id);
+    }
 
-    int needs_redraw = 0;
+    sudoku_hud_begin(game);
+    reset_input_vga();
+    redraw = SUDOKU_REDRAW_FULL;
+}
 
-    if (action == INPUT_EXIT) {
-        menu_state = MENU_STATE_MAIN;
-        return;
-    }
+void sudoku_screen_enter(void) {
+    game = arena_alloc(&session_arena, sizeof(SudokuGame));
+    phase = SUDOKU_PLAYING;
+    prev_keys = (int)mmio_keys();
+    sudoku_start();
+}
 
-    if (action != INPUT_NONE) {
-        sudoku_update(&game, action);
-        needs_redraw = 1;
-    }
+int sudoku_screen_update(void) {
+    switch (phase) {
+        case SUDOKU_PLAYING: {
+            InputAction action;
+            PROF_SCOPE(PROF_INPUT) action = get_input_vga();
+
+            if (action == INPUT_EXIT) return MENU_STATE_MAIN;
+
+            if (action == INPUT_ENTER && !game->notes_mode) {
+                // Plain KEY1 asks for a hint: the cursor goes to the forced cell, the status bar says why
+                SudokuHint hint;
+                char text[HINT_TEXT_MAX + 1];
+                sudoku_hint_find(game, &hint);
+                sudoku_hint_text(&hint, text);
+                game->selected_row = hint.row;
+                game->selected_col = hint.col;
+                sudoku_hud_hint(text);
+                redraw = SUDOKU_REDRAW_CURSOR;
+            } else if (action != INPUT_NONE) {
+                sudoku_hud_hint(0);
+                // Moves (held KEY1 repeats them) only move the cursor sprite, note edits
+                // just the mini digits that changed
+                int moved = action == INPUT_UP || action == INPUT_DOWN || action == INPUT_LEFT || action == INPUT_RIGHT;
+                int noted = action == INPUT_NOTES || action == INPUT_ENTER ||
+                            (action == INPUT_INCREMENT && game->notes_mode);
+                old_notes = game->grid.cells[game->selected_row][game->selected_col].notes;
+                sudoku_update(game, action);
+                redraw = moved ? SUDOKU_REDRAW_CURSOR : noted ? SUDOKU_REDRAW_NOTES : SUDOKU_REDRAW_FULL;
+            }
 
-    // Only check for win/loss after the user submits (KEY1) and board is full
-    if (sudoku_is_full(&game) && game.state == GAME_RUNNING) {
-        sudoku_render_vga(&game); // Redraw to show full board
-
-        // Wait for KEY1 press
-        int prev_keys = *keys;
-        while (1) { 
-            int curr_keys = *keys;
-            int was_pressed = !(prev_keys & KEY_MASK);      // Previously pressed
-            int is_pressed  = !(curr_keys & KEY_MASK);      // Currently pressed
-            int key1_press_edge = (!was_pressed && is_pressed); // Rising edge detection
-
-            if (key1_press_edge) {  // On KEY1 press
-                sudoku_check_win(&game); // Now check for win/loss
-                needs_redraw = 1;       // Redraw to show win/loss state
-                break;  
+            // Only check for win/loss after the user submits (KEY1) and board is full
+            if (sudoku_is_full(game) && game->state == GAME_RUNNING) {
+                redraw = SUDOKU_REDRAW_FULL;    // Show the full board
+                prev_keys = (int)mmio_keys();
+                phase = SUDOKU_WAIT_CHECK;
             }
-            prev_keys = curr_keys;  
-            delay(1);
+            break;
         }
-    }
-
-    if (needs_redraw) {
-        sudoku_render_vga(&game);
-    }
 
-    // Wait for KEY1 to return to menu after win/loss
-    if ((game.state == GAME_WON || game.state == GAME_LOST)) { 
-        int prev_keys = *keys;
-        while (1) {
-            int curr_keys = *keys;
-            int was_pressed = !(prev_keys & KEY_MASK);
-            int is_pressed  = !(curr_keys & KEY_MASK);
-            int key1_press_edge = (!was_pressed && is_pressed);
-
-            if (key1_press_edge) {
-                menu_state = MENU_STATE_MAIN;
-                return;
+        case SUDOKU_WAIT_CHECK:
+            if (key1_pressed()) {
+                sudoku_check_win(game);    // Now check for win/loss
+                redraw = SUDOKU_REDRAW_FULL;
+                phase = SUDOKU_WAIT_EXIT;
             }
-            prev_keys = curr_keys;
-            delay(1);
-        }
-    }
+            break;
 
-    delay(1);
+        case SUDOKU_WAIT_EXIT:
+            if (key1_pressed()) return MENU_STATE_MAIN;    // KEY1 to return to menu after win/loss
+            break;
+    }
+    return MENU_STATE_SUDOKU;
 }
+
+void sudoku_screen_render(void) {
+    if (redraw == SUDOKU_REDRAW_FULL) sudoku_render_vga(game);
+    else if (redraw == SUDOKU_REDRAW_CURSOR) sudoku_render_cursor_vga(game);
+    else if (redraw == SUDOKU_REDRAW_NOTES) sudoku_render_notes_vga(game, old_notes);
+    redraw = 0;
 }
 
 void delay(int ms){ // Simple busy-wait delay
     volatile int i, j;
+    SIM_IDLE(ms * 10000);
     for (i = 0; i < ms * 10000; i++)
     {
         j = i;
@@ -254,13 +318,3 @@ void delay(int ms){ // Simple busy-wait delay
 
 void test(void) { 
 }
-
-SudokuDifficulty get_selected_difficulty_from_switches(void) {
-    volatile int *SWITCHES = (volatile int *) SWITCH_base;
-    int switches = *SWITCHES;
-    
-    if (switches & (1 << SW_l3)) return HARD;    // SW3
-    if (switches & (1 << SW_l2)) return MEDIUM;  // SW2  
-    if (switches & (1 << SW_l1)) return EASY;    // SW1
-    return EASY; // default
-}
\ No newline at end of file
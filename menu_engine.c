@@ -0,0 +1,134 @@
+// Zunjee, Karen, table-driven menu engine, drawn with the display list over RLE background art
+#include "menu_engine.h"
+#include "dtekv_board.h"
+#include "display_list.h"
+
+// Layout: title on the plate of the background art, item boxes in a column, controls at the bottom
+#define TITLE_Y 20
+#define ITEM_X 80
+#define ITEM_W 160
+#define ITEM_H 26
+#define ITEM_PITCH 30
+#define ITEM_TOP 64
+#define ITEM_BORDER 3
+#define STATUS_Y 212
+#define STATUS_W 208            // Plate under the status line, redrawn alone when the text changes
+#define FOOTER_Y 226
+#define FOOTER "SW4 SW5 MOVE KEY1 PICK SW8 BACK"
+
+_Static_assert(ITEM_TOP + (MENU_VISIBLE - 1) * ITEM_PITCH + ITEM_H <= STATUS_Y - 2, "menu items run into the status line");
+
+static const MenuPage *top(const Menu *m) {
+    return m->stack[m->depth - 1];
+}
+
+static int text_width(const char *s) {
+    int n = 0;
+    while (s[n]) n++;
+    return n * 8;
+}
+
+// Highlight on the item holding the page's current choice, scrolled into view
+static void enter_page(Menu *m) {
+    const MenuPage *page = top(m);
+    m->highlight = 0;
+    for (int i = 0; i < page->count; i++)
+        if (page->items[i].value == m->choice[page->slot]) m->highlight = i;
+    m->first = m->highlight >= MENU_VISIBLE ? m->highlight - MENU_VISIBLE + 1 : 0;
+    m->redraw_page = 1;
+    m->unlit = -1;
+}
+
+void menu_open(Menu *m, const MenuPage *root, int *choice, const RleImage *background) {
+    m->stack[0] = root;
+    m->depth = 1;
+    m->choice = choice;
+    m->background = background;
+    m->status = 0;
+    m->redraw_status = 0;
+    enter_page(m);
+}
+
+void menu_move(Menu *m, int delta) {
+    int next = m->highlight + delta;
+    if (next < 0 || next >= top(m)->count) return;
+    if (m->unlit < 0) m->unlit = m->highlight;     // Several moves between draws leave one box to clear
+    m->highlight = next;
+    // Scrolling moves every box, still only the visible ones are drawn
+    if (next < m->first) {
+        m->first = next;
+        m->redraw_page = 1;
+    } else if (next >= m->first + MENU_VISIBLE) {
+        m->first = next - MENU_VISIBLE + 1;
+        m->redraw_page = 1;
+    }
+}
+
+int menu_pick(Menu *m) {
+    const MenuPage *page = top(m);
+    const MenuItem *item = &page->items[m->highlight];
+    m->choice[page->slot] = item->value;
+    if (!item->next) return 1;
+    if (m->depth < MENU_MAX_DEPTH) {
+        m->stack[m->depth++] = item->next;
+        enter_page(m);
+    }
+    return 0;
+}
+
+void menu_back(Menu *m) {
+    if (m->depth <= 1) return;
+    m->depth--;
+    enter_page(m);
+}
+
+void menu_invalidate(Menu *m) {
+    m->redraw_page = 1;
+}
+
+void menu_status(Menu *m, const char *text, uint8_t color) {
+    m->status = text;
+    m->status_color = color;
+    m->redraw_status = 1;
+}
+
+static void draw_status(const Menu *m) {
+    if (!m->status) return;
+    dl_rect((SCREEN_W - STATUS_W) / 2, STATUS_Y - 2, STATUS_W, 12, black);
+    dl_text((SCREEN_W - text_width(m->status)) / 2, STATUS_Y, m->status, m->status_color);
+}
+
+static void draw_item(const Menu *m, int index) {
+    int slot = index - m->first;
+    if (slot < 0 || slot >= MENU_VISIBLE) return;
+    const char *label = top(m)->items[index].label;
+    int y = ITEM_TOP + slot * ITEM_PITCH;
+    int lit = index == m->highlight;
+    dl_rect(ITEM_X, y, ITEM_W, ITEM_H, lit ? yellow : dark_gray);
+    dl_rect(ITEM_X + ITEM_BORDER, y + ITEM_BORDER, ITEM_W - 2 * ITEM_BORDER, ITEM_H - 2 * ITEM_BORDER, lit ? white : gray);
+    dl_text(ITEM_X + (ITEM_W - text_width(label)) / 2, y + (ITEM_H - 8) / 2, label, black);
+}
+
+int menu_draw(Menu *m) {
+    const MenuPage *page = top(m);
+    if (m->redraw_page) {
+        rle_draw(m->background, 0, 0);
+        dl_text((SCREEN_W - text_width(page->title)) / 2, TITLE_Y, page->title, pink);
+        for (int i = m->first; i < page->count && i < m->first + MENU_VISIBLE; i++) draw_item(m, i);
+        draw_status(m);
+        dl_text((SCREEN_W - text_width(FOOTER)) / 2, FOOTER_Y, FOOTER, black);
+    } else if (m->unlit >= 0 || m->redraw_status) {
+        if (m->unlit >= 0) {
+            draw_item(m, m->unlit);
+            draw_item(m, m->highlight);
+        }
+        if (m->redraw_status) draw_status(m);
+    } else {
+        return 0;
+    }
+    dl_flush();
+    m->redraw_page = 0;
+    m->unlit = -1;
+    m->redraw_status = 0;
+    return 1;
+}
@@ -0,0 +1,52 @@
+// Zunjee, Karen, table-driven menu: pages of items with sub-menus, the picks stored by slot,
+// and a highlight that moves by redrawing only the two item boxes it leaves and enters
+#ifndef MENU_ENGINE_H
+#define MENU_ENGINE_H
+
+#include "rle.h"
+
+#define MENU_MAX_DEPTH 4        // Pages open at once, the root included
+#define MENU_VISIBLE 5          // Item boxes on screen, longer pages scroll under them
+
+typedef struct MenuPage MenuPage;
+
+typedef struct {
+    const char *label;
+    int value;                  // Stored in the page's slot when the item is picked
+    const MenuPage *next;       // Sub-menu, NULL when picking it closes the menu
+} MenuItem;
+
+struct MenuPage {
+    const char *title;
+    int slot;                   // Index into the menu's choice array
+    int count;
+    const MenuItem *items;
+};
+
+typedef struct {
+    const MenuPage *stack[MENU_MAX_DEPTH];
+    int depth;
+    int *choice;                // Picked values by slot, also where the highlight starts on a page
+    const RleImage *background;
+    int highlight;              // Item on the open page
+    int first;                  // First item in a box
+    int redraw_page;            // Everything on the next draw
+    int unlit;                  // Item to draw without the highlight, -1 for none
+    const char *status;         // Line above the footer, NULL for none
+    uint8_t status_color;
+    int redraw_status;
+} Menu;
+
+// Root page open, highlight on the item matching the choice already made
+void menu_open(Menu *m, const MenuPage *root, int *choice, const RleImage *background);
+
+void menu_move(Menu *m, int delta);    // Highlight up (-1) or down (+1), stops at the ends
+int menu_pick(Menu *m);                // Stores the value, 1 when the menu is done, else opens the sub-menu
+void menu_back(Menu *m);               // Parent page, nothing at the root
+void menu_invalidate(Menu *m);         // Something else used the screen, draw the whole page next
+void menu_status(Menu *m, const char *text, uint8_t color);   // Text is kept, call again after changing it
+
+// Draw what changed since the last call, 0 when nothing did
+int menu_draw(Menu *m);
+
+#endif
@@ -6,51 +6,56 @@
 #include "main_menu.h"
 #include "minesweeper.h"
 #include "sudoku_vga.h"
+#include "profile.h"
+#include "display_list.h"
+#include "ms_hint.h"
+#include "latency.h"
+#include "hud.h"
+#include "key_repeat.h"
+#include "timer.h"
+#include "sched.h"
+#include "game_pool.h"
+#include "arena.h"
+#include "assets.h"
+#include "sprite.h"
+#include "art.h"
+#include "mmio.h"
 
-extern int menu_state;
 extern void draw_text(int x, int y, const char *text, uint8_t color);
 
-uint8_t mine_grid[GRID_MAX_ROWS][GRID_MAX_COLS];
-uint8_t adj[GRID_MAX_ROWS][GRID_MAX_COLS]; 
-uint8_t state_grid[GRID_MAX_ROWS][GRID_MAX_COLS];
-int g_rows = 0, g_cols = 0, g_mines = 0;
-int revealed_count = 0;
-int game_over = 0;
-int cursor_r = 0, cursor_c = 0;
-
-// Memory mapped addresses
-#define SW_REG  ((volatile uint32_t*) SWITCH_BASE)
-#define KEY_REG ((volatile uint32_t*) KEY1_base)
-#define VGA_FB  ((volatile uint8_t*) VGA_Buffer)
-#define SCREEN_W 320
-#define SCREEN_H 240
+// Viewport position, logic never touches it
+int cam_r = 0, cam_c = 0;
 
-#define SW_MASK(x) (1u << (x))
+// Hidden cells are shaded by mine chance while set (SW8+SW9 with KEY1)
+static int hint_mode = 0;
 
-static const LevelSpec LEVELS[3] = {
-    {9, 9, 10}, //Easy
-    {16, 12, 30}, //Medium
-    {20, 16, 70} //Hard
-};
+#define VIEW_H (VIEW_ROWS * CELL_SIZE)     // Board viewport, the status bar is below it
+#define BANNER_Y ((VIEW_H - HUD_BANNER_H) / 2)
+#define ART_Y (BANNER_Y - 44)               // End of game art above the banner
+#define NOTICE_MS 1000                      // A notice banner stays up this long
+#define GAME_OVER_MS 750                    // End of game banner, then back to the menu
 
+#define SW_MASK(x) (1u << (x))
 
-static int first_move = 1; 
+// Hex cells are pointy-top, CELL_SIZE wide and HEX_H tall. Rows are still CELL_SIZE apart, so each
+// row's points fill the notches of the rows above and below; the top row's points are off screen.
+#define HEX_TIP 4
+#define HEX_H (CELL_SIZE + HEX_TIP)
 
-// Simple LFSR PRNG for embedded
-static uint32_t lfsr = 0xACE1u;
+// Row insets of the black hex and of the interior drawn over it two rows lower, the border is 1 pixel
+// across the flat sides and a little more along the slopes
+static const uint8_t hex_outer[HEX_H] = { 5, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 5 };
+static const uint8_t hex_inner[HEX_H - 4] = { 5, 3, 2, 1, 1, 1, 1, 1, 1, 2, 3, 5 };
 
-uint32_t rand32(void) {
-    uint32_t bit = ((lfsr >> 0) ^ (lfsr >> 2) ^ (lfsr >> 3) ^ (lfsr >> 5)) & 1u;
-    lfsr = (lfsr >> 1) | (bit << 15);
-    uint32_t r = lfsr;
-    r ^= (r << 5);
-    r ^= (r >> 11);
-    r ^= (r << 7);
-    return r;
-}
+// What the game loop has to redraw before the next present
+#define REDRAW_NONE 0
+#define REDRAW_CURSOR 1     // Cursor moved, camera may have scrolled
+#define REDRAW_CELLS 2      // Cells inside the dirty box changed
+#define REDRAW_FULL 4       // Whole viewport, hint shading or a notice changed
 
 
 void busy_wait(volatile int n) {
+    SIM_IDLE(n);
     while (n-- > 0) {
         asm volatile("nop");
     }
@@ -58,7 +63,7 @@ void busy_wait(volatile int n) {
 
 inline void put_pixel(int x, int y, uint8_t color) {
     if (x < 0 || x >= SCREEN_W || y < 0 || y >= SCREEN_H) return;
-    VGA_FB[y * SCREEN_W + x] = color;
+    fb_write(y * SCREEN_W + x, color);
 }
 
 void fill_rect(int x0, int y0, int w, int h, uint8_t color) {
@@ -69,294 +74,255 @@ void fill_rect(int x0, int y0, int w, int h, uint8_t color) {
     if (x1 > SCREEN_W) x1 = SCREEN_W;
     if (y1 > SCREEN_H) y1 = SCREEN_H;
     for (int y = y0; y < y1; ++y) {
-        uint8_t *row = (uint8_t*)&VGA_FB[y * SCREEN_W];
-        for (int x = x0; x < x1; ++x) row[x] = color;
+        uint8_t *row = (uint8_t*)fb_span_write(y * SCREEN_W + x0, x1 - x0);
+        for (int x = 0; x < x1 - x0; ++x) row[x] = color;
     }
 }
 
-static const uint8_t font5x7_digits[10][5] = {
-    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0
-    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 1
-    {0x42, 0x61, 0x51, 0x49, 0x46}, // 2
-    {0x21, 0x41, 0x45, 0x4B, 0x31}, // 3
-    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 4
-    {0x27, 0x45, 0x45, 0x45, 0x39}, // 5
-    {0x3C, 0x4A, 0x49, 0x49, 0x30}, // 6
-    {0x01, 0x71, 0x09, 0x05, 0x03}, // 7
-    {0x36, 0x49, 0x49, 0x49, 0x36}, // 8
-    {0x06, 0x49, 0x49, 0x29, 0x1E}  // 9
-};
+// Top-left of a cell's box in the viewport, hex rows are staggered by half a cell
+static int cell_x(const MinesweeperBoard *b, int r, int c) {
+    int x = (c - cam_c) * CELL_SIZE;
+    return b->topology == MS_TOPO_HEX && (r & 1) ? x + CELL_SIZE / 2 : x;
+}
 
+static int cell_y(const MinesweeperBoard *b, int r) {
+    int y = (r - cam_r) * CELL_SIZE;
+    return b->topology == MS_TOPO_HEX ? y - HEX_TIP : y;
+}
 
+// Height of a cell's box
+static int cell_h(const MinesweeperBoard *b) {
+    return b->topology == MS_TOPO_HEX ? HEX_H : CELL_SIZE;
+}
 
-void draw_digit_in_cell(int grid_r, int grid_c, int digit, uint8_t color) {
+void draw_digit_in_cell(const MinesweeperBoard *b, int grid_r, int grid_c, int digit, uint8_t color) {
     if (digit < 0 || digit > 9) return;
-    int cell_x = grid_c * CELL_SIZE;
-    int cell_y = grid_r * CELL_SIZE;
     /* digit area: 5x7 */
-    int gx = cell_x + (CELL_SIZE - 5) / 2;
-    int gy = cell_y + (CELL_SIZE - 7) / 2;
-    const uint8_t *glyph = font5x7_digits[digit];
-    for (int col = 0; col < 5; ++col) {
-        uint8_t colbits = glyph[col];
-        for (int row = 0; row < 7; ++row) {
-            if (colbits & (1 << row)) {
-                put_pixel(gx + col, gy + row, color);
-            }
-        }
-    }
+    int gx = cell_x(b, grid_r, grid_c) + (CELL_SIZE - 5) / 2;
+    int gy = cell_y(b, grid_r) + (cell_h(b) - 7) / 2;
+    dl_glyph(gx, gy, font5x7_digits[digit], 5, 7, GLYPH_COLS_LSB, 1, color);
 }
 
-// Draw cell border
-void draw_cell_border(int r, int c, uint8_t border_color) {
-    int x0 = c * CELL_SIZE;
-    int y0 = r * CELL_SIZE;
-
-    for (int x = x0; x < x0 + CELL_SIZE; ++x) {
-        put_pixel(x, y0, border_color);
-        put_pixel(x, y0 + CELL_SIZE - 1, border_color);
+// Draw cell border, a hex one is filled and goes under the interior
+void draw_cell_border(const MinesweeperBoard *b, int r, int c, uint8_t border_color) {
+    if (b->topology == MS_TOPO_HEX) {
+        dl_shape(cell_x(b, r, c), cell_y(b, r), CELL_SIZE, HEX_H, hex_outer, border_color);
+    } else {
+        dl_frame(cell_x(b, r, c), cell_y(b, r), CELL_SIZE, CELL_SIZE, border_color);
     }
-    for (int y = y0; y < y0 + CELL_SIZE; ++y) {
-        put_pixel(x0, y, border_color);
-        put_pixel(x0 + CELL_SIZE - 1, y, border_color);
+}
+
+// Cell inside its 1 pixel border
+static void draw_interior(const MinesweeperBoard *b, int x0, int y0, uint8_t color) {
+    if (b->topology == MS_TOPO_HEX) {
+        dl_shape(x0, y0 + 2, CELL_SIZE, HEX_H - 4, hex_inner, color);
+    } else {
+        dl_rect(x0 + 1, y0 + 1, CELL_SIZE - 2, CELL_SIZE - 2, color);
     }
 }
 
-// Render whole board
-void render_board(void) {
-    // Background
-    fill_rect(0, 0, SCREEN_W, SCREEN_H, light_blue);
+// Green for safe through red for a certain mine, RGB332
+static uint8_t hint_color(int chance) {
+    int red_level = chance * 14 / HINT_CERTAIN;
+    int green_level = (HINT_CERTAIN - chance) * 14 / HINT_CERTAIN;
+    if (red_level > 7) red_level = 7;
+    if (green_level > 7) green_level = 7;
+    return (uint8_t)((red_level << 5) | (green_level << 2));
+}
 
-    // Draw cell
-    for (int r = 0; r < g_rows; ++r) {
-        for (int c = 0; c < g_cols; ++c) {
-            int x0 = c * CELL_SIZE;
-            int y0 = r * CELL_SIZE;
-            // Cell interior
-            if (state_grid[r][c] == HIDDEN) {
-                fill_rect(x0 + 1, y0 + 1, CELL_SIZE - 2, CELL_SIZE - 2, light_gray);
-            } else if (state_grid[r][c] == FLAGGED) {
-                fill_rect(x0 + 1, y0 + 1, CELL_SIZE - 2, CELL_SIZE - 2, gray);
-                // Flagg
-                int fx = x0 + (CELL_SIZE - 3) / 2;
-                int fy = y0 + (CELL_SIZE - 5) / 2;
-                fill_rect(fx, fy, 1, 5, black);
-                fill_rect(fx+1, fy, 2, 3, red);
-            } else if (state_grid[r][c] == REVEALED) {
-                if (mine_grid[r][c]) {
-                    fill_rect(x0 + 1, y0 + 1, CELL_SIZE - 2, CELL_SIZE - 2, white);
-                    //Mine
-                    int cx = x0 + CELL_SIZE/2;
-                    int cy = y0 + CELL_SIZE/2;
-                    put_pixel(cx, cy, black);
-                    put_pixel(cx-1, cy, black);
-                    put_pixel(cx+1, cy, black);
-                    put_pixel(cx, cy-1, black);
-                    put_pixel(cx, cy+1, black);
-                } else {
-                    fill_rect(x0 + 1, y0 + 1, CELL_SIZE - 2, CELL_SIZE - 2, dark_gray);
-                    if (adj[r][c] > 0) {
-                        //Number color
-                        uint8_t col = blue;
-                        switch (adj[r][c]) {
-                            case 1: col = blue; break;
-                            case 2: col = green; break;
-                            case 3: col = red; break;
-                            case 4: col = dark_blue; break;
-                            case 5: col = magenta; break;
-                            case 6: col = cyan; break;
-                            case 7: col = brown; break;
-                            default: col = black; break;
-                        }
-                        draw_digit_in_cell(r, c, adj[r][c], col);
-                    }
+// Emit one cell (interior, content and border) at its viewport position
+void draw_cell(const MinesweeperBoard *b, int r, int c) {
+    int x0 = cell_x(b, r, c);
+    int y0 = cell_y(b, r);
+    int h = cell_h(b);
+    int hex = b->topology == MS_TOPO_HEX;
+    CellState st = cell_state(b, r, c);
+
+    if (hex) draw_cell_border(b, r, c, black);
+
+    // Cell interior
+    if (st == HIDDEN) {
+        draw_interior(b, x0, y0, hint_mode ? hint_color(hint_mine_chance(b, r, c)) : light_gray);
+    } else if (st == FLAGGED) {
+        draw_interior(b, x0, y0, gray);
+        // Flagg
+        int fx = x0 + (CELL_SIZE - 3) / 2;
+        int fy = y0 + (h - 5) / 2;
+        dl_rect(fx, fy, 1, 5, black);
+        dl_rect(fx+1, fy, 2, 3, red);
+    } else {        // REVEALED, or FLOOD_PENDING while an opening spreads
+        int n = cell_adj(b, r, c);
+        if (n == MINE_CODE) {
+            draw_interior(b, x0, y0, white);
+            //Mine
+            int cx = x0 + CELL_SIZE/2;
+            int cy = y0 + h/2;
+            dl_rect(cx - 1, cy, 3, 1, black);
+            dl_rect(cx, cy - 1, 1, 3, black);
+        } else {
+            draw_interior(b, x0, y0, dark_gray);
+            if (n > 0) {
+                //Number color
+                uint8_t col = blue;
+                switch (n) {
+                    case 1: col = blue; break;
+                    case 2: col = green; break;
+                    case 3: col = red; break;
+                    case 4: col = dark_blue; break;
+                    case 5: col = magenta; break;
+                    case 6: col = cyan; break;
+                    case 7: col = brown; break;
+                    default: col = black; break;
                 }
+                draw_digit_in_cell(b, r, c, n, col);
             }
-            draw_cell_border(r, c, black);
         }
     }
+    if (!hex) draw_cell_border(b, r, c, black);
+}
 
-    // Raw cursor (inverted border)
-    int cx0 = cursor_c * CELL_SIZE;
-    int cy0 = cursor_r * CELL_SIZE;
-    // Draw a highlighted border
-    for (int x = cx0; x < cx0 + CELL_SIZE; ++x) {
-        put_pixel(x, cy0, light_yellow);
-        put_pixel(x, cy0 + CELL_SIZE - 1, light_yellow);
-    }
-    for (int y = cy0; y < cy0 + CELL_SIZE; ++y) {
-        put_pixel(cx0, y, light_yellow);
-        put_pixel(cx0 + CELL_SIZE - 1, y, light_yellow);
-    }
+// Emit the cells of rows r0..r1-1 and columns c0..c1-1, clipped to the viewport
+static void draw_cell_range(const MinesweeperBoard *b, int r0, int r1, int c0, int c1) {
+    int vr1 = cam_r + VIEW_ROWS, vc1 = cam_c + VIEW_COLS;
+    if (r0 < cam_r) r0 = cam_r;
+    if (c0 < cam_c) c0 = cam_c;
+    if (r1 > vr1) r1 = vr1;
+    if (c1 > vc1) c1 = vc1;
+    if (r1 > b->rows) r1 = b->rows;
+    if (c1 > b->cols) c1 = b->cols;
+    for (int r = r0; r < r1; ++r)
+        for (int c = c0; c < c1; ++c)
+            draw_cell(b, r, c);
 }
 
-// Initialize board arrays
-void clear_board_state(void) {
-    for (int r = 0; r < GRID_MAX_ROWS; ++r) {
-        for (int c = 0; c < GRID_MAX_COLS; ++c) {
-            mine_grid[r][c] = 0;
-            adj[r][c] = 0;
-            state_grid[r][c] = HIDDEN;
-        }
-    }
+// Cursor frame, a save-under sprite drawn after the cells are flushed: a move without a scroll
+// puts back the old frame's pixels and draws the new one, no cell is drawn again
+static Sprite cursor;
+
+_Static_assert(CELL_SIZE <= SPRITE_MAX_SIDE, "cursor larger than a sprite");
+
+// On a hex board the frame spans the cell's row pitch, so it stays on screen for the top row too
+static void draw_cursor_frame(const MinesweeperBoard *b) {
+    sprite_show(&cursor, cell_x(b, b->cursor_r, b->cursor_c), (b->cursor_r - cam_r) * CELL_SIZE, CELL_SIZE, CELL_SIZE, light_yellow);
 }
 
-// Place mines randomly
-void place_mines(int rows, int cols, int mines, int safe_r, int safe_c) {
-    int placed = 0;
-    mine_grid[safe_r][safe_c] = 0; // Ensure first click is not a mine
+// Render the whole viewport, cost is bounded by VIEW_ROWS x VIEW_COLS whatever the board size
+void render_board(const MinesweeperBoard *b) {
+    PROF_BEGIN(PROF_RENDER_BOARD);
 
-    for (int dr = -1; dr <= 1; ++dr) {
-        for (int dc = -1; dc <= 1; ++dc) {
-            int rr = safe_r + dr, cc = safe_c + dc;
-            if (rr >= 0 && rr < rows && cc >= 0 && cc < cols) {
-                mine_grid[rr][cc] = 0; // Clear adjacent cells too
-            }
-        }
-    }
+    // Background, the status bar below the viewport is left to the HUD
+    sprite_forget(&cursor);
+    dl_rect(0, 0, SCREEN_W, VIEW_H, light_blue);
 
-    while (placed < mines) {
-        uint32_t r = rand32() % rows;
-        uint32_t c = rand32() % cols;
+    // Draw cell
+    draw_cell_range(b, cam_r, cam_r + VIEW_ROWS, cam_c, cam_c + VIEW_COLS);
 
-        // Skip if this is the safe cell or adjacent to it
-        if (abs((int)r - safe_r) <= 1 && abs((int)c - safe_c) <= 1) {
-            continue;
-        }
+    dl_flush();
+    draw_cursor_frame(b);
 
-        if (!mine_grid[r][c]) {
-            mine_grid[r][c] = 1;
-            placed++;
-        }
-    }
+    PROF_END(PROF_RENDER_BOARD);
 }
 
-void compute_adj(int rows, int cols) {
-    for (int r = 0; r < rows; ++r) {
-        for (int c = 0; c < cols; ++c) {
-            if (mine_grid[r][c]) { adj[r][c] = 0xFF; continue; }
-            int cnt = 0;
-            for (int dr = -1; dr <= 1; ++dr)
-            for (int dc = -1; dc <= 1; ++dc) {
-                if (dr == 0 && dc == 0) continue;
-                int rr = r + dr, cc = c + dc;
-                if (rr >= 0 && rr < rows && cc >= 0 && cc < cols) {
-                    if (mine_grid[rr][cc]) cnt++;
-                }
-            }
-            adj[r][c] = (uint8_t)cnt;
-        }
-    }
+// Redraw the changed cells that are on screen, the camera has not moved since they were drawn
+void render_cells(const MinesweeperBoard *b, const MsChange *ch) {
+    if (ch->r0 > ch->r1) return;
+
+    PROF_BEGIN(PROF_RENDER_BOARD);
+
+    sprite_hide(&cursor);   // The cursor cell may be one of them
+    draw_cell_range(b, ch->r0, ch->r1 + 1, ch->c0, ch->c1 + 1);
+
+    dl_flush();
+    draw_cursor_frame(b);
+
+    PROF_END(PROF_RENDER_BOARD);
 }
 
-void flood_reveal(int sr, int sc) {
-    if (sr < 0 || sr >= g_rows || sc < 0 || sc >= g_cols) return;
-    if (state_grid[sr][sc] == REVEALED || state_grid[sr][sc] == FLAGGED) return;
-    if (mine_grid[sr][sc]) return;
-
-    // Simple stack for malloc etc.
-    int *stack_r = (int*)0; 
-    static int st_r[GRID_MAX_ROWS * GRID_MAX_COLS];
-    static int st_c[GRID_MAX_ROWS * GRID_MAX_COLS];
-    stack_r = st_r;
-    int *stack_c = st_c;
-    int top = 0;
-    stack_r[top] = sr;
-    stack_c[top] = sc;
-    top++;
-    while (top > 0) {
-        top--;
-        int r = stack_r[top];
-        int c = stack_c[top];
-        if (r < 0 || r >= g_rows || c < 0 || c >= g_cols) continue;
-        if (state_grid[r][c] == REVEALED || state_grid[r][c] == FLAGGED) continue;
-        state_grid[r][c] = REVEALED;
-        revealed_count++;
-        if (adj[r][c] == 0) {
-            for (int dr = -1; dr <= 1; ++dr)
-            for (int dc = -1; dc <= 1; ++dc) {
-                if (dr == 0 && dc == 0) continue;
-                int rr = r + dr, cc = c + dc;
-                if (rr >= 0 && rr < g_rows && cc >= 0 && cc < g_cols) {
-                    if (state_grid[rr][cc] == HIDDEN && !mine_grid[rr][cc]) {
-                        stack_r[top] = rr;
-                        stack_c[top] = cc;
-                        top++;
-                    }
-                }
-            }
+// Shift the viewport pixels by (dx, dy), both multiples of 4 so whole words are copied
+void scroll_viewport(int dx, int dy) {
+    const int w = VIEW_COLS * CELL_SIZE;
+    const int h = VIEW_ROWS * CELL_SIZE;
+    int y_start = (dy > 0) ? h - 1 : 0;     // Walk rows away from the direction of motion
+    int y_step  = (dy > 0) ? -1 : 1;
+
+    for (int n = 0; n < h; ++n) {
+        int y = y_start + n * y_step;
+        int sy = y - dy;
+        if (sy < 0 || sy >= h) continue;
+        int words = w / 4, shift = dx / 4;
+        int copied = (words - (shift < 0 ? -shift : shift)) * 4;
+        uint32_t *dst = (uint32_t*)fb_span_write(y * SCREEN_W, copied);
+        const uint32_t *src = (const uint32_t*)fb_span_read(sy * SCREEN_W, copied);
+        if (dx > 0) {
+            for (int i = words - 1; i >= shift; --i) dst[i] = src[i - shift];
+        } else {
+            for (int i = 0; i < words + shift; ++i) dst[i] = src[i - shift];
         }
     }
 }
 
-void reveal_cell(int r, int c) {
-    if (r < 0 || r >= g_rows || c < 0 || c >= g_cols) return;
-    if (state_grid[r][c] == REVEALED) return;
-    if (state_grid[r][c] == FLAGGED) return;
+// Redraw after a cursor move: the cursor sprite alone normally, the exposed strip if the camera scrolled
+void render_cursor_update(const MinesweeperBoard *b, int old_cam_r, int old_cam_c) {
+    int dr = cam_r - old_cam_r;
+    int dc = cam_c - old_cam_c;
 
-    //Place mines at first reveal to ensure first cell is not a mine
-    if (first_move) {
-        place_mines(g_rows, g_cols, g_mines, r, c);
-        compute_adj(g_rows, g_cols);
-        first_move = 0;
+    // Staggered hex rows do not shift by whole words and the bottom row's points stick out of the
+    // copied area, a scrolled hex board is drawn again whole
+    if (abs(dr) >= VIEW_ROWS || abs(dc) >= VIEW_COLS || (b->topology == MS_TOPO_HEX && (dr || dc))) {
+        render_board(b);
+        return;
     }
 
-    if (mine_grid[r][c]) {
-        // Click on mine
-        game_over = 1;
-        // Eeveal all mines
-        for (int rr = 0; rr < g_rows; ++rr)
-            for (int cc = 0; cc < g_cols; ++cc)
-                if (mine_grid[rr][cc]) state_grid[rr][cc] = REVEALED;
-        return;
+    PROF_BEGIN(PROF_RENDER_BOARD);
+
+    if (dr != 0 || dc != 0) {
+        sprite_hide(&cursor);   // Not carried along by the scroll
+        scroll_viewport(-dc * CELL_SIZE, -dr * CELL_SIZE);
+        if (dr > 0) draw_cell_range(b, cam_r + VIEW_ROWS - dr, cam_r + VIEW_ROWS, cam_c, cam_c + VIEW_COLS);
+        if (dr < 0) draw_cell_range(b, cam_r, cam_r - dr, cam_c, cam_c + VIEW_COLS);
+        if (dc > 0) draw_cell_range(b, cam_r, cam_r + VIEW_ROWS, cam_c + VIEW_COLS - dc, cam_c + VIEW_COLS);
+        if (dc < 0) draw_cell_range(b, cam_r, cam_r + VIEW_ROWS, cam_c, cam_c - dc);
     }
 
-    if (adj[r][c] == 0) {
-        flood_reveal(r, c);
+    dl_flush();
+    draw_cursor_frame(b);
+
+    PROF_END(PROF_RENDER_BOARD);
+}
+
+// Move the camera so the cursor stays CAMERA_MARGIN cells inside the viewport, returns 1 if it moved
+int update_camera(const MinesweeperBoard *b) {
+    int old_r = cam_r, old_c = cam_c;
+
+    if (b->rows > VIEW_ROWS) {
+        if (b->cursor_r < cam_r + CAMERA_MARGIN) cam_r = b->cursor_r - CAMERA_MARGIN;
+        if (b->cursor_r >= cam_r + VIEW_ROWS - CAMERA_MARGIN) cam_r = b->cursor_r - VIEW_ROWS + CAMERA_MARGIN + 1;
+        if (cam_r < 0) cam_r = 0;
+        if (cam_r > b->rows - VIEW_ROWS) cam_r = b->rows - VIEW_ROWS;
     } else {
-        state_grid[r][c] = REVEALED;
-        revealed_count++;
+        cam_r = 0;
     }
-    int total = g_rows * g_cols;
-    if (revealed_count >= total - g_mines) {
-        game_over = 2;
-    }
-}
 
-void toggle_flag(int r, int c) {
-    if (r < 0 || r >= g_rows || c < 0 || c >= g_cols) return;
-    if (state_grid[r][c] == REVEALED) return;
-    if (state_grid[r][c] == HIDDEN) state_grid[r][c] = FLAGGED;
-    else if (state_grid[r][c] == FLAGGED) state_grid[r][c] = HIDDEN;
-}
+    if (b->cols > VIEW_COLS) {
+        if (b->cursor_c < cam_c + CAMERA_MARGIN) cam_c = b->cursor_c - CAMERA_MARGIN;
+        if (b->cursor_c >= cam_c + VIEW_COLS - CAMERA_MARGIN) cam_c = b->cursor_c - VIEW_COLS + CAMERA_MARGIN + 1;
+        if (cam_c < 0) cam_c = 0;
+        if (cam_c > b->cols - VIEW_COLS) cam_c = b->cols - VIEW_COLS;
+    } else {
+        cam_c = 0;
+    }
 
-void start_new_game(SudokuDifficulty d) {
-    first_move = 1;
-    clear_board_state();
-
-    int diff_index = (int)d;
-    LevelSpec spec = LEVELS[diff_index];
-    g_cols = spec.cols;
-    g_rows = spec.rows;
-    g_mines = spec.mines;
-    if (g_cols > GRID_MAX_COLS) g_cols = GRID_MAX_COLS;
-    if (g_rows > GRID_MAX_ROWS) g_rows = GRID_MAX_ROWS;
-
-    // Center cursor
-    cursor_r = g_rows / 2;
-    cursor_c = g_cols / 2;
-    revealed_count = 0;
-    game_over = 0;
+    return cam_r != old_r || cam_c != old_c;
 }
 
 // Read switches
 inline uint32_t read_switches(void) {
-    return *SW_REG;
+    return mmio_switches();
 }
 
 // Read keys
 inline uint32_t read_keys(void) {
-    return *KEY_REG;
+    return mmio_keys();
 }
 
 // Poll until key released to avoid multi-fire from a single press
@@ -367,73 +333,210 @@ void wait_key_release_all(void) {
     }
 }
 
-int minesweeper(void) {
-    busy_wait(100000);
+// Status bar: level and board shape on the left, mines not yet flagged and safe cells still hidden on the right
+static void hud_begin(MsLevel level, MsTopology topology) {
+    static const char *level_names[MS_LEVEL_COUNT] = { "EASY", "MEDIUM", "HARD", "HUGE", "GIANT" };
+    static const char *topology_names[MS_TOPO_COUNT] = { "", " TORUS", " HEX" };
+    char status[13];
+    int n = 0;
+    for (const char *t = level_names[level]; *t; t++) status[n++] = *t;
+    for (const char *t = topology_names[topology]; *t; t++) status[n++] = *t;
+    status[n] = '\0';
+    hud_reset();
+    hud_bar(VIEW_H, SCREEN_H - VIEW_H, dark_gray);
+    hud_place(HUD_STATUS, 4, 12 * 8 + 2 * HUD_BAR_PAD, white);
+    hud_place(HUD_COUNT_A, 120, 10 * 8 + 2 * HUD_BAR_PAD, white);
+    hud_place(HUD_COUNT_B, 220, 10 * 8 + 2 * HUD_BAR_PAD, white);
+    hud_set_text(HUD_STATUS, status);
+}
 
-    // Get difficulty from main menu selection
-    SudokuDifficulty diff = get_selected_difficulty_from_switches();
-    start_new_game(diff);
-    render_board();
+// Add the cells in ch to the box waiting for a redraw
+static void dirty_add(MsChange *dirty, const MsChange *ch) {
+    if (ch->r0 > ch->r1) return;
+    if (ch->r0 < dirty->r0) dirty->r0 = ch->r0;
+    if (ch->r1 > dirty->r1) dirty->r1 = ch->r1;
+    if (ch->c0 < dirty->c0) dirty->c0 = ch->c0;
+    if (ch->c1 > dirty->c1) dirty->c1 = ch->c1;
+}
 
-    uint32_t prev_keys = 0;
-    int needs_redraw = 1;
-    int game_over_counter = 0;
-    const int GAME_OVER_DELAY = 150;
+static void update_hud(const MinesweeperBoard *b) {
+    hud_set_number(HUD_COUNT_A, "MINES", b->mines - b->flag_count);
+    hud_set_number(HUD_COUNT_B, "LEFT", b->rows * b->cols - b->mines - b->revealed_count);
+}
 
-    while (1) {
-        if (needs_redraw) {
-            render_board();
-            needs_redraw = 0;
-        }
+_Static_assert(ARENA_ROUND(MAX_CELLS) + HINT_ALLOC_BYTES(MAX_CELLS) <= SESSION_ARENA_BYTES,
+               "largest board does not fit the session arena");
+
+// Game state between scheduler ticks
+static MinesweeperBoard board;      // Cells and hint maps are in the session arena, sized for the level
+static MsLevel level;
+static int pooled;                  // board.mine_order came from the pool and is not released yet
+static KeyRepeat key1;
+static int needs_redraw;
+static MsChange dirty;
+static int old_cam_r, old_cam_c;
+static int notice_up;
+static uint32_t notice_until;
+static int game_over_shown;
+static int game_over_art;     // Drawn once over the board, the menu takes the screen after
+static uint32_t game_over_until;
+
+static void dirty_clear(void) {
+    dirty.r0 = dirty.c0 = 0x7FFF;
+    dirty.r1 = dirty.c1 = -1;
+}
 
-        // Game over handling
-        if (game_over != 0) {
-            game_over_counter++;
-            
-            if (game_over_counter <= GAME_OVER_DELAY) {
-                if (game_over == 1) {
-                    draw_text(SCREEN_W/2 - 40, SCREEN_H/2, "GAME OVER", red);
-                } else {
-                    draw_text(SCREEN_W/2 - 40, SCREEN_H/2, "YOU WIN!", green);
-                }
+// Mines are placed by the first reveal, the pooled list is free again after it
+static void release_pool(void) {
+    if (!pooled) return;
+    ms_pool_release(level);
+    board.mine_order = NULL;
+    pooled = 0;
+}
+
+void minesweeper_enter(void) {
+    MinesweeperBoard *b = &board;
+
+    level = menu_minesweeper_level();     // Picked on the menu's level and board pages
+    MsTopology topology = menu_minesweeper_topology();
+    const LevelSpec *spec = ms_level_spec(level);
+    int cells = spec->rows * spec->cols;
+    b->cells = arena_alloc(&session_arena, (uint32_t)cells);   // Freed with the session on the way back to the menu
+    hint_alloc(&session_arena, cells);
+    start_new_game(b, level, topology);
+    uint32_t id = menu_take_puzzle_id(ms_pool_id(level));  // The pool's next one unless the menu replays one
+    b->mine_order = ms_pool_take(level, id);    // Usually shuffled in the menu, NULL draws them at random instead
+    pooled = b->mine_order != NULL;
+    hint_reset(b);
+    cam_r = cam_c = 0;
+    update_camera(b);
+    hud_begin(level, topology);
+
+    key_repeat_init(&key1, key1_down(read_keys()));     // KEY1 may still be down from the menu
+    needs_redraw = REDRAW_FULL;
+    dirty_clear();
+    notice_up = 0;
+    game_over_shown = 0;
+    game_over_art = 0;
+}
+
+int minesweeper_update(void) {
+    MinesweeperBoard *b = &board;
+    uint32_t now = timer_ms();
+
+    // A notice banner times out on its own, taking it down puts the board pixels back
+    if (notice_up && (int32_t)(now - notice_until) >= 0) {
+        notice_up = 0;
+        hud_hide(HUD_BANNER);
+    }
+
+    // Game over handling, the banner is drawn once and stays until the menu takes over
+    if (b->game_over != 0) {
+        if (!game_over_shown) {
+            game_over_shown = 1;
+            game_over_until = now + GAME_OVER_MS;
+            notice_up = 0;
+            release_pool();
+            if (b->game_over == 1) {
+                hud_banner(HUD_BANNER, BANNER_Y, "GAME OVER", red, black);
             } else {
-                // Return to main menu
-                menu_state = MENU_STATE_MAIN;
-                return 0;
+                hud_banner(HUD_BANNER, BANNER_Y, "YOU WIN", green, black);
             }
-            
-            busy_wait(50000);
-            continue;
+        } else if ((int32_t)(now - game_over_until) >= 0) {
+            return MENU_STATE_MAIN;     // Return to main menu
         }
+        return MENU_STATE_MINEWEEPER;
+    }
 
-        // Normal game input processing
-        uint32_t sw = read_switches();
-        uint32_t keys = read_keys();
-
-        uint32_t key_pressed = keys & (1u << KEY_enter);
-        uint32_t prev_key_pressed = prev_keys & (1u << KEY_enter);
-
-        if (key_pressed && !prev_key_pressed) {
-            needs_redraw = 1;
-            
-            if (sw & SW_MASK(SW_up)) {
-                if (cursor_r > 0) cursor_r--;
-            } else if (sw & SW_MASK(SW_down)) {
-                if (cursor_r < g_rows - 1) cursor_r++;
-            } else if (sw & SW_MASK(SW_left)) {
-                if (cursor_c > 0) cursor_c--;
-            } else if (sw & SW_MASK(SW_right)) {
-                if (cursor_c < g_cols - 1) cursor_c++;
-            } else if (sw & SW_MASK(SW_ACTION_1)) {
-                toggle_flag(cursor_r, cursor_c);
-            } else if (sw & SW_MASK(SW_ACTION_2)) {
-                reveal_cell(cursor_r, cursor_c);
-            }
+    // Normal game input processing
+    PROF_BEGIN(PROF_INPUT);
+    uint32_t sw = read_switches();
+    uint32_t keys = read_keys();
+    PROF_END(PROF_INPUT);
+
+    // A press, or a repeat while KEY1 stays down on a direction switch
+    uint32_t directions = SW_MASK(SW_up) | SW_MASK(SW_down) | SW_MASK(SW_left) | SW_MASK(SW_right);
+    KeyEvent event = key_repeat_poll(&key1, key1_down(keys), (sw & directions) != 0);
+
+    if (event != KEY_EVENT_NONE) {
+        needs_redraw |= REDRAW_CURSOR;
+        old_cam_r = cam_r;
+        old_cam_c = cam_c;
+
+        // A torus cursor goes off one edge and comes back at the opposite one
+        int wrap = b->topology == MS_TOPO_TORUS;
+        if (sw & SW_MASK(SW_up)) {
+            LAT_INPUT(LAT_MOVE);
+            if (b->cursor_r > 0) b->cursor_r--;
+            else if (wrap) b->cursor_r = b->rows - 1;
+        } else if (sw & SW_MASK(SW_down)) {
+            LAT_INPUT(LAT_MOVE);
+            if (b->cursor_r < b->rows - 1) b->cursor_r++;
+            else if (wrap) b->cursor_r = 0;
+        } else if (sw & SW_MASK(SW_left)) {
+            LAT_INPUT(LAT_MOVE);
+            if (b->cursor_c > 0) b->cursor_c--;
+            else if (wrap) b->cursor_c = b->cols - 1;
+        } else if (sw & SW_MASK(SW_right)) {
+            LAT_INPUT(LAT_MOVE);
+            if (b->cursor_c < b->cols - 1) b->cursor_c++;
+            else if (wrap) b->cursor_c = 0;
+        } else if ((sw & SW_MASK(SW_ACTION_1)) && (sw & SW_MASK(SW_ACTION_2))) {
+            hint_mode = !hint_mode;
+            hud_banner(HUD_BANNER, BANNER_Y, hint_mode ? "HINTS ON" : "HINTS OFF", white, dark_gray);
+            notice_up = 1;
+            notice_until = now + NOTICE_MS;
+            needs_redraw = REDRAW_FULL;
+        } else if (sw & SW_MASK(SW_ACTION_1)) {
+            LAT_INPUT(LAT_FLAG);
+            toggle_flag(b, b->cursor_r, b->cursor_c);
+            hint_note_change(&b->last_change);
+            dirty_add(&dirty, &b->last_change);
+            needs_redraw |= REDRAW_CELLS;
+        } else if (sw & SW_MASK(SW_ACTION_2)) {
+            // A zero cell only opens here, the slices below spread it
+            LAT_INPUT(LAT_REVEAL);
+            reveal_start(b, b->cursor_r, b->cursor_c);
+            if (!b->first_move) release_pool();
+            hint_note_change(&b->last_change);
+            dirty_add(&dirty, &b->last_change);
+            needs_redraw |= REDRAW_CELLS;
         }
+        update_camera(b);
+    }
 
-        prev_keys = keys;
-        busy_wait(30000);
+    // A large opening spreads a slice per tick, input is still read in between
+    if (flood_active(b)) {
+        flood_step(b, MS_FLOOD_SLICE);
+        hint_note_change(&b->last_change);
+        dirty_add(&dirty, &b->last_change);
+        needs_redraw |= REDRAW_CELLS;
+        if (flood_active(b)) sched_hurry();     // The next slice is due at once
     }
 
-    return 0;
+    return MENU_STATE_MINEWEEPER;
+}
+
+void minesweeper_render(void) {
+    MinesweeperBoard *b = &board;
+
+    if (hint_mode && (needs_redraw & REDRAW_CELLS)) needs_redraw = REDRAW_FULL;   // Shading moves beyond the cells
+    if (needs_redraw != REDRAW_NONE) hud_lift();
+    if (needs_redraw & REDRAW_FULL) {
+        if (hint_mode) hint_update(b);
+        render_board(b);
+    } else {
+        if (needs_redraw & REDRAW_CURSOR) render_cursor_update(b, old_cam_r, old_cam_c);
+        if (needs_redraw & REDRAW_CELLS) render_cells(b, &dirty);
+    }
+    dirty_clear();
+    if (game_over_shown && !game_over_art) {
+        const RleImage *art = b->game_over == 1 ? &art_mine_burst : &art_trophy;
+        rle_draw(art, (SCREEN_W - art->w) / 2, ART_Y);
+        game_over_art = 1;
+        needs_redraw |= REDRAW_CELLS;   // Presented with the banner
+    }
+    update_hud(b);
+    if (hud_draw() || needs_redraw != REDRAW_NONE) vga_present();
+    needs_redraw = REDRAW_NONE;
 }
@@ -8,12 +8,49 @@
 
 /* Game constants */
 #define CELL_SIZE 12
-#define GRID_MAX_COLS 26   /* = 320 / 12 */
-#define GRID_MAX_ROWS 20   /* = 240 / 12 */
+#define GRID_MAX_COLS 256  /* boards larger than the screen scroll */
+#define GRID_MAX_ROWS 256
 #define MAX_CELLS (GRID_MAX_ROWS * GRID_MAX_COLS)
+#define VIEW_COLS 26       /* = 320 / 12, cells visible at once */
+#define VIEW_ROWS 19       /* = 228 / 12, the status bar takes the last 12 pixels */
+#define CAMERA_MARGIN 3    /* cells kept between the cursor and the viewport edge */
+#define MINE_CODE 0xF      /* adj value stored for a mine */
 
-/* Cell states */
-typedef enum { HIDDEN=0, REVEALED=1, FLAGGED=2 } CellState;
+/* Cell states, FLOOD_PENDING is a revealed cell an opening has parked until it can be expanded */
+typedef enum { HIDDEN=0, REVEALED=1, FLAGGED=2, FLOOD_PENDING=3 } CellState;
+
+/* Board sizes, the first three follow the Sudoku difficulties */
+typedef enum {
+    MS_EASY = 0,
+    MS_MEDIUM = 1,
+    MS_HARD = 2,
+    MS_HUGE = 3,    /* 100x100 */
+    MS_GIANT = 4,   /* 256x256 */
+    MS_LEVEL_COUNT
+} MsLevel;
+
+/* Board shapes, the neighbours a count and an opening go through */
+typedef enum {
+    MS_TOPO_SQUARE = 0,     /* 8 neighbours, edges are walls */
+    MS_TOPO_TORUS = 1,      /* 8 neighbours, each edge wraps around to the opposite one */
+    MS_TOPO_HEX = 2,        /* 6 neighbours, odd rows sit half a cell to the right */
+    MS_TOPO_COUNT
+} MsTopology;
+
+#define MS_MAX_NEIGHBOURS 8
+#define MS_NEIGHBOUR_CLASSES 18     /* Top, middle or bottom row by left, middle or right column, by row parity */
+
+/* Neighbours of every cell of one class, wrap and edges already applied so loops need no bounds checks */
+typedef struct {
+    int count;
+    int16_t dr[MS_MAX_NEIGHBOURS], dc[MS_MAX_NEIGHBOURS];
+    int32_t di[MS_MAX_NEIGHBOURS];      /* Cell index delta, dr * cols + dc */
+} MsNeighbours;
+
+/* Cells touched by the last reveal_cell/toggle_flag, inclusive bounds, r0 > r1 when nothing changed */
+typedef struct {
+    int r0, c0, r1, c1;
+} MsChange;
 
 /* Level specification */
 typedef struct {
@@ -21,41 +58,131 @@ typedef struct {
     int mines;
 } LevelSpec;
 
-// External declarations for game state
-extern uint8_t mine_grid[GRID_MAX_ROWS][GRID_MAX_COLS];
-extern uint8_t adj[GRID_MAX_ROWS][GRID_MAX_COLS];
-extern uint8_t state_grid[GRID_MAX_ROWS][GRID_MAX_COLS];
-extern int g_rows, g_cols, g_mines;
-extern int revealed_count;
-extern int game_over;
-extern int cursor_r, cursor_c;
+#define MS_FLOOD_STACK 1024    /* Flood cells waiting in the board, overflow is parked as FLOOD_PENDING */
+#define MS_FLOOD_SLICE 48      /* Cells a flood_step expands per game loop turn */
+
+/* Cell byte: neighbour mine count or MINE_CODE in the low nibble, CellState in bits 4-5 */
+#define CELL_ADJ_MASK 0x0F
+#define CELL_STATE_SHIFT 4
+
+/* One game. Everything the logic touches on every move sits together at the front,
+   cells points at one byte per cell so a cell's count and state share a load.
+   The owner provides cells, rows * cols bytes for the level about to be started.
+   Boards are independent, any number can exist at once. */
+typedef struct {
+    int rows, cols, mines;
+    int revealed_count;
+    int flag_count;
+    int game_over;              // 0 running, 1 hit a mine, 2 won
+    int first_move;             // Mines are placed on the first reveal
+    int cursor_r, cursor_c;
+    uint32_t rng;               // xorshift32 state, set with ms_seed
+    const uint16_t *mine_order; // Shuffled cell indices for the first move, NULL draws mines at random
+    MsChange last_change;
+    int flood_top;              // Cells on flood_stack
+    int flood_parked;           // FLOOD_PENDING cells wait somewhere in flood_area
+    int scan_r, scan_c;         // Where the search for parked cells goes on, scan_r < 0 when idle
+    MsChange flood_area;        // Every cell the opening in progress has revealed
+    uint16_t flood_stack[MS_FLOOD_STACK];
+    MsTopology topology;
+    uint8_t row_class[GRID_MAX_ROWS];   // Class of a cell is row_class[r] + col_class[c]
+    uint8_t col_class[GRID_MAX_COLS];
+    MsNeighbours neighbours[MS_NEIGHBOUR_CLASSES];  // Built by start_new_game for the board's size and shape
+    uint8_t *cells;             // Row major, cols is the row stride
+} MinesweeperBoard;
+
+extern int cam_r, cam_c;        // Top-left cell of the viewport
+
+// Cell access
+static inline int cell_index(const MinesweeperBoard *b, int r, int c) {
+    return r * b->cols + c;
+}
+
+static inline int cell_adj(const MinesweeperBoard *b, int r, int c) {
+    return b->cells[cell_index(b, r, c)] & CELL_ADJ_MASK;
+}
+
+static inline int is_mine(const MinesweeperBoard *b, int r, int c) {
+    return cell_adj(b, r, c) == MINE_CODE;
+}
+
+static inline CellState cell_state(const MinesweeperBoard *b, int r, int c) {
+    return (CellState)(b->cells[cell_index(b, r, c)] >> CELL_STATE_SHIFT);
+}
+
+// Neighbours of (r, c): cell (r + dr[k], c + dc[k]) for k below count, always on the board
+static inline const MsNeighbours *cell_neighbours(const MinesweeperBoard *b, int r, int c) {
+    return &b->neighbours[b->row_class[r] + b->col_class[c]];
+}
+
+// Revealed, including cells parked by an opening still in progress
+static inline int is_open(const MinesweeperBoard *b, int r, int c) {
+    CellState s = cell_state(b, r, c);
+    return s == REVEALED || s == FLOOD_PENDING;
+}
+
+// An opening is still spreading, flood_step carries it on
+static inline int flood_active(const MinesweeperBoard *b) {
+    return b->flood_top > 0 || b->flood_parked;
+}
+
+static inline void set_cell_adj(MinesweeperBoard *b, int r, int c, int v) {
+    uint8_t *cell = &b->cells[cell_index(b, r, c)];
+    *cell = (uint8_t)((*cell & ~CELL_ADJ_MASK) | v);
+}
+
+static inline void set_cell_state(MinesweeperBoard *b, int r, int c, CellState s) {
+    uint8_t *cell = &b->cells[cell_index(b, r, c)];
+    *cell = (uint8_t)((*cell & CELL_ADJ_MASK) | ((int)s << CELL_STATE_SHIFT));
+}
 
 // Function declarations
 
-int minesweeper(void);
 int abs(int n);
 void draw_text(int x, int y, const char *text, uint8_t color);
 
+// Game screen, a scheduler state (sched.h)
+void minesweeper_enter(void);
+int minesweeper_update(void);
+void minesweeper_render(void);
+
 // Game initialization
-void start_new_game(SudokuDifficulty d);
-void clear_board_state(void);
-void place_mines(int rows, int cols, int mines, int safe_r, int safe_c);
-void compute_adj(int rows, int cols);
+const LevelSpec *ms_level_spec(MsLevel level);
+void ms_seed(MinesweeperBoard *b, uint32_t seed);
+void start_new_game(MinesweeperBoard *b, MsLevel level, MsTopology topology);
+void clear_board_state(MinesweeperBoard *b);
+void place_mines(MinesweeperBoard *b, int safe_r, int safe_c);
+void place_mines_ordered(MinesweeperBoard *b, const uint16_t *order, int safe_r, int safe_c);
+
+// Puzzle IDs: the mine order of an ID is the identity list after a partial Fisher-Yates seeded by the
+// ID and level, so with the first click it fixes the board. Only the first mines + 9 entries are drawn.
+uint32_t ms_order_seed(uint32_t id, MsLevel level);
+void ms_order_shuffle(uint16_t *cells, int count, int from, int end, uint32_t *rng);   // Entries from..end-1
+void compute_adj(MinesweeperBoard *b);
 
 // Game logics
-void reveal_cell(int r, int c);
-void toggle_flag(int r, int c);
-void flood_reveal(int sr, int sc);
+void reveal_cell(MinesweeperBoard *b, int r, int c);       // Runs any opening to the end
+void reveal_start(MinesweeperBoard *b, int r, int c);      // Leaves an opening to flood_step
+int flood_step(MinesweeperBoard *b, int budget);           // Expand up to budget cells, 1 while more are left
+void toggle_flag(MinesweeperBoard *b, int r, int c);
+void flood_reveal(MinesweeperBoard *b, int sr, int sc);
+
+// Camera
+int update_camera(const MinesweeperBoard *b);
 
 // Rendering
-void render_board(void);
-void draw_cell_border(int r, int c, uint8_t border_color);
-void draw_digit_in_cell(int grid_r, int grid_c, int digit, uint8_t color);
+void render_board(const MinesweeperBoard *b);
+void render_cells(const MinesweeperBoard *b, const MsChange *ch);
+void render_cursor_update(const MinesweeperBoard *b, int old_cam_r, int old_cam_c);
+void scroll_viewport(int dx, int dy);
+void draw_cell(const MinesweeperBoard *b, int r, int c);
+void draw_cell_border(const MinesweeperBoard *b, int r, int c, uint8_t border_color);
+void draw_digit_in_cell(const MinesweeperBoard *b, int grid_r, int grid_c, int digit, uint8_t color);
 void draw_text(int x, int y, const char *text, uint8_t color);
 
 
 // Utility functions
-uint32_t rand32(void);
+uint32_t rand32(MinesweeperBoard *b);
 void busy_wait(volatile int n);
 void put_pixel(int x, int y, uint8_t color);
 void fill_rect(int x0, int y0, int w, int h, uint8_t color);
@@ -65,4 +192,4 @@ uint32_t read_switches(void);
 uint32_t read_keys(void);
 void wait_key_release_all(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,426 @@
+// Karen, minesweeper game logic, no rendering or MMIO so it also builds for the host tools
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "minesweeper.h"
+#include "profile.h"
+
+static const LevelSpec LEVELS[MS_LEVEL_COUNT] = {
+    {9, 9, 10}, //Easy
+    {16, 12, 30}, //Medium
+    {20, 16, 70}, //Hard
+    {100, 100, 2000}, //Huge
+    {256, 256, 13000} //Giant
+};
+
+// Simple xorshift PRNG for embedded, a 16-bit LFSR repeats too soon to fill the large boards
+uint32_t rand32(MinesweeperBoard *b) {
+    uint32_t r = b->rng;
+    r ^= (r << 13);
+    r ^= (r >> 17);
+    r ^= (r << 5);
+    b->rng = r;
+    return r;
+}
+
+// Restart the board's PRNG, the same seed gives the same mine layout for the same first click
+void ms_seed(MinesweeperBoard *b, uint32_t seed) {
+    b->rng = seed ? seed : 0xACE1u;   // xorshift state must not be zero
+}
+
+// Board size of a level
+const LevelSpec *ms_level_spec(MsLevel level) {
+    return &LEVELS[level];
+}
+
+// Start a new change record for the next action
+static void change_reset(MinesweeperBoard *b) {
+    b->last_change.r0 = b->last_change.c0 = 0x7FFF;
+    b->last_change.r1 = b->last_change.c1 = -1;
+}
+
+// Grow a change record to include (r, c)
+static inline void change_grow(MsChange *ch, int r, int c) {
+    if (r < ch->r0) ch->r0 = r;
+    if (r > ch->r1) ch->r1 = r;
+    if (c < ch->c0) ch->c0 = c;
+    if (c > ch->c1) ch->c1 = c;
+}
+
+// The action's own record
+static inline void change_cell(MinesweeperBoard *b, int r, int c) {
+    change_grow(&b->last_change, r, c);
+}
+
+// Initialize the cells, only the part used by the current rows x cols board
+void clear_board_state(MinesweeperBoard *b) {
+    int cells = b->rows * b->cols;
+    for (int i = 0; i < cells; ++i) b->cells[i] = 0;     // HIDDEN with no neighbours
+}
+
+// The first click and its neighbours, mines are kept off them so the click opens an area
+static int safe_zone(const MinesweeperBoard *b, int r, int c, int zone[MS_MAX_NEIGHBOURS + 1]) {
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    int i = cell_index(b, r, c);
+    zone[0] = i;
+    for (int k = 0; k < nb->count; ++k) zone[k + 1] = i + nb->di[k];
+    return nb->count + 1;
+}
+
+static int in_zone(const int *zone, int n, int i) {
+    for (int k = 0; k < n; ++k)
+        if (zone[k] == i) return 1;
+    return 0;
+}
+
+// Place mines randomly
+void place_mines(MinesweeperBoard *b, int safe_r, int safe_c) {
+    int rows = b->rows, cols = b->cols, mines = b->mines;
+    int placed = 0;
+    int zone[MS_MAX_NEIGHBOURS + 1];
+    int zone_n = safe_zone(b, safe_r, safe_c, zone);
+
+    while (placed < mines) {
+        uint32_t r = rand32(b) % rows;
+        uint32_t c = rand32(b) % cols;
+
+        // Skip if this is the safe cell or adjacent to it
+        if (in_zone(zone, zone_n, cell_index(b, r, c))) {
+            continue;
+        }
+
+        if (!is_mine(b, r, c)) {
+            set_cell_adj(b, r, c, MINE_CODE);
+            placed++;
+        }
+    }
+}
+
+// Mines from a shuffled list of cell indices, skipping the safe cell and its neighbours. No retries,
+// and the counts are raised around each mine as it goes in so compute_adj is not needed.
+// The list needs at least mines + 9 shuffled entries.
+void place_mines_ordered(MinesweeperBoard *b, const uint16_t *order, int safe_r, int safe_c) {
+    int zone[MS_MAX_NEIGHBOURS + 1];
+    int zone_n = safe_zone(b, safe_r, safe_c, zone);
+    int placed = 0;
+    for (int k = 0; placed < b->mines; ++k) {
+        int i = order[k];
+        if (in_zone(zone, zone_n, i)) continue;
+
+        int r = i / b->cols;
+        int c = i - r * b->cols;
+        b->cells[i] |= MINE_CODE;
+        placed++;
+        const MsNeighbours *nb = cell_neighbours(b, r, c);
+        for (int n = 0; n < nb->count; ++n) {
+            uint8_t *cell = &b->cells[i + nb->di[n]];
+            if ((*cell & CELL_ADJ_MASK) != MINE_CODE) (*cell)++;    // Counts stay below MINE_CODE
+        }
+    }
+}
+
+// Murmur3 finalizer over the ID and level, nearby IDs shuffle nothing alike
+uint32_t ms_order_seed(uint32_t id, MsLevel level) {
+    uint32_t h = id ^ (0x9E3779B9u * ((uint32_t)level + 1));
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h ? h : 0xACE1u;     // xorshift state must not be zero
+}
+
+// After the steps up to end the first end entries are a uniform sample, the rest are left alone
+void ms_order_shuffle(uint16_t *cells, int count, int from, int end, uint32_t *rng) {
+    for (int i = from; i < end; i++) {
+        uint32_t r = *rng;
+        r ^= (r << 13);
+        r ^= (r >> 17);
+        r ^= (r << 5);
+        *rng = r;
+        int j = i + (int)(r % (uint32_t)(count - i));
+        uint16_t t = cells[i];
+        cells[i] = cells[j];
+        cells[j] = t;
+    }
+}
+
+void compute_adj(MinesweeperBoard *b) {
+    int rows = b->rows, cols = b->cols;
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            if (is_mine(b, r, c)) continue;
+            const MsNeighbours *nb = cell_neighbours(b, r, c);
+            const uint8_t *cell = &b->cells[cell_index(b, r, c)];
+            int cnt = 0;
+            for (int k = 0; k < nb->count; ++k) cnt += (cell[nb->di[k]] & CELL_ADJ_MASK) == MINE_CODE;
+            set_cell_adj(b, r, c, cnt);
+        }
+    }
+}
+
+// Drop the opening in progress, cells it already revealed stay revealed
+static void flood_stop(MinesweeperBoard *b) {
+    b->flood_top = 0;
+    b->flood_parked = 0;
+    b->scan_r = -1;
+}
+
+// Safe cells are counted as they are revealed, so a win is known before an opening stops spreading
+static void check_win(MinesweeperBoard *b) {
+    if (b->game_over) return;
+    if (b->revealed_count >= b->rows * b->cols - b->mines) {
+        b->game_over = 2;
+        flood_stop(b);
+    }
+}
+
+// Reveal (r, c) and queue it, cells that do not fit on the stack wait on the board as FLOOD_PENDING
+static inline void flood_push(MinesweeperBoard *b, int r, int c) {
+    b->revealed_count++;
+    change_cell(b, r, c);
+    change_grow(&b->flood_area, r, c);
+    if (b->flood_top < MS_FLOOD_STACK) {
+        set_cell_state(b, r, c, REVEALED);
+        b->flood_stack[b->flood_top++] = (uint16_t)cell_index(b, r, c);
+    } else {
+        set_cell_state(b, r, c, FLOOD_PENDING);
+        b->flood_parked = 1;
+    }
+}
+
+// Start an opening at (r, c), or join the one already spreading
+static void flood_start(MinesweeperBoard *b, int r, int c) {
+    if (!flood_active(b)) {
+        b->flood_area.r0 = b->flood_area.c0 = 0x7FFF;
+        b->flood_area.r1 = b->flood_area.c1 = -1;
+    }
+    flood_push(b, r, c);
+}
+
+// Stack ran over at some point: walk the flood area and queue the parked cells again,
+// one budget unit per 8 cells looked at. Nothing is expanded during a walk so the area
+// holds still; a walk stopped by a full stack starts over once the stack has drained.
+static int flood_rescan(MinesweeperBoard *b, int budget) {
+    const MsChange *a = &b->flood_area;
+    int looked = 0;
+    if (b->scan_r < 0) {
+        b->scan_r = a->r0;
+        b->scan_c = a->c0;
+    }
+    while (b->scan_r <= a->r1) {
+        if (budget <= 0) return 0;
+        if (b->flood_top == MS_FLOOD_STACK) {
+            b->scan_r = -1;
+            return budget;
+        }
+        int r = b->scan_r, c = b->scan_c;
+        if (++b->scan_c > a->c1) {
+            b->scan_c = a->c0;
+            b->scan_r++;
+        }
+        if ((++looked & 7) == 0) budget--;
+        if (cell_state(b, r, c) != FLOOD_PENDING) continue;
+        set_cell_state(b, r, c, REVEALED);
+        change_cell(b, r, c);
+        b->flood_stack[b->flood_top++] = (uint16_t)cell_index(b, r, c);
+    }
+    b->scan_r = -1;
+    b->flood_parked = 0;
+    return budget;
+}
+
+// Expand queued cells until the budget is spent or the opening is done.
+// Cells are marked when pushed, so each cell is queued at most once.
+static void flood_run(MinesweeperBoard *b, int budget) {
+    while (budget > 0) {
+        if (b->scan_r >= 0 || (b->flood_top == 0 && b->flood_parked)) {
+            budget = flood_rescan(b, budget);
+            continue;
+        }
+        if (b->flood_top == 0) break;
+
+        // Cell indices fit in 16 bits for boards up to 256x256
+        int i = b->flood_stack[--b->flood_top];
+        int r = i / b->cols;
+        int c = i - r * b->cols;
+        budget--;
+        if (cell_adj(b, r, c) != 0) continue;
+        const MsNeighbours *nb = cell_neighbours(b, r, c);
+        for (int k = 0; k < nb->count; ++k) {
+            int rr = r + nb->dr[k], cc = c + nb->dc[k];
+            if (cell_state(b, rr, cc) == HIDDEN && !is_mine(b, rr, cc)) flood_push(b, rr, cc);
+        }
+    }
+}
+
+// Open the zero region around (sr, sc) in one go
+void flood_reveal(MinesweeperBoard *b, int sr, int sc) {
+    if (sr < 0 || sr >= b->rows || sc < 0 || sc >= b->cols) return;
+    if (cell_state(b, sr, sc) != HIDDEN) return;
+    if (is_mine(b, sr, sc)) return;
+
+    PROF_BEGIN(PROF_FLOOD_REVEAL);
+    flood_start(b, sr, sc);
+    flood_run(b, INT32_MAX);
+    PROF_END(PROF_FLOOD_REVEAL);
+}
+
+// One slice of the opening in progress, last_change covers just the cells this slice revealed
+int flood_step(MinesweeperBoard *b, int budget) {
+    change_reset(b);
+    if (!flood_active(b)) return 0;
+
+    PROF_BEGIN(PROF_FLOOD_REVEAL);
+    flood_run(b, budget);
+    PROF_END(PROF_FLOOD_REVEAL);
+
+    check_win(b);
+    return flood_active(b);
+}
+
+// A zero cell opens its region right away (sliced = 0) or is left to flood_step
+static void reveal(MinesweeperBoard *b, int r, int c, int sliced) {
+    change_reset(b);
+    if (r < 0 || r >= b->rows || c < 0 || c >= b->cols) return;
+    if (is_open(b, r, c)) return;
+    if (cell_state(b, r, c) == FLAGGED) return;
+
+    //Place mines at first reveal to ensure first cell is not a mine
+    if (b->first_move) {
+        if (b->mine_order) {
+            place_mines_ordered(b, b->mine_order, r, c);
+        } else {
+            place_mines(b, r, c);
+            compute_adj(b);
+        }
+        b->first_move = 0;
+    }
+
+    if (is_mine(b, r, c)) {
+        // Click on mine
+        b->game_over = 1;
+        flood_stop(b);
+        // Eeveal all mines
+        for (int rr = 0; rr < b->rows; ++rr)
+            for (int cc = 0; cc < b->cols; ++cc)
+                if (is_mine(b, rr, cc)) set_cell_state(b, rr, cc, REVEALED);
+        change_cell(b, 0, 0);
+        change_cell(b, b->rows - 1, b->cols - 1);
+        return;
+    }
+
+    if (cell_adj(b, r, c) == 0) {
+        if (sliced) flood_start(b, r, c);
+        else flood_reveal(b, r, c);
+    } else {
+        set_cell_state(b, r, c, REVEALED);
+        change_cell(b, r, c);
+        b->revealed_count++;
+    }
+    check_win(b);
+}
+
+void reveal_cell(MinesweeperBoard *b, int r, int c) {
+    reveal(b, r, c, 0);
+}
+
+// Reveal without waiting for the opening, which joins one already spreading if there is one
+void reveal_start(MinesweeperBoard *b, int r, int c) {
+    reveal(b, r, c, 1);
+}
+
+void toggle_flag(MinesweeperBoard *b, int r, int c) {
+    change_reset(b);
+    if (r < 0 || r >= b->rows || c < 0 || c >= b->cols) return;
+    if (is_open(b, r, c)) return;
+    if (cell_state(b, r, c) == HIDDEN) {
+        set_cell_state(b, r, c, FLAGGED);
+        b->flag_count++;
+    } else if (cell_state(b, r, c) == FLAGGED) {
+        set_cell_state(b, r, c, HIDDEN);
+        b->flag_count--;
+    }
+    change_cell(b, r, c);
+}
+
+// Neighbour offsets before edges and wrap, square ones in row-major order. Hex boards use odd-r
+// offsets: the rows above and below reach one cell further left from even rows, further right from odd ones.
+static const int8_t SQUARE_DR[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+static const int8_t SQUARE_DC[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+static const int8_t HEX_DR[6] = { -1, -1, 0, 0, 1, 1 };
+static const int8_t HEX_DC[2][6] = { { -1, 0, -1, 1, -1, 0 }, { 0, 1, -1, 1, 0, 1 } };
+
+// First, inner or last row (column)
+static int edge_class(int i, int n) {
+    return i == 0 ? 0 : i == n - 1 ? 2 : 1;
+}
+
+// Neighbours of (r, c), which stands for every cell of its class
+static void build_class(MinesweeperBoard *b, MsNeighbours *nb, int r, int c) {
+    int hex = b->topology == MS_TOPO_HEX;
+    nb->count = 0;
+    for (int k = 0; k < (hex ? 6 : 8); ++k) {
+        int rr = r + (hex ? HEX_DR[k] : SQUARE_DR[k]);
+        int cc = c + (hex ? HEX_DC[r & 1][k] : SQUARE_DC[k]);
+        if (b->topology == MS_TOPO_TORUS) {
+            rr = (rr + b->rows) % b->rows;
+            cc = (cc + b->cols) % b->cols;
+        } else if (rr < 0 || rr >= b->rows || cc < 0 || cc >= b->cols) {
+            continue;
+        }
+        nb->dr[nb->count] = (int16_t)(rr - r);
+        nb->dc[nb->count] = (int16_t)(cc - c);
+        nb->di[nb->count] = cell_index(b, rr, cc) - cell_index(b, r, c);
+        nb->count++;
+    }
+}
+
+// Class of every row and column, then one table per class from a cell that has it.
+// Hex rows also split by parity, their offsets differ.
+static void build_neighbours(MinesweeperBoard *b) {
+    int row_of[6] = { -1, -1, -1, -1, -1, -1 }, col_of[3] = { -1, -1, -1 };
+    for (int r = 0; r < b->rows; ++r) {
+        int k = edge_class(r, b->rows) + (b->topology == MS_TOPO_HEX ? 3 * (r & 1) : 0);
+        b->row_class[r] = (uint8_t)(3 * k);
+        if (row_of[k] < 0) row_of[k] = r;
+    }
+    for (int c = 0; c < b->cols; ++c) {
+        int k = edge_class(c, b->cols);
+        b->col_class[c] = (uint8_t)k;
+        if (col_of[k] < 0) col_of[k] = c;
+    }
+    for (int rk = 0; rk < 6; ++rk)
+        for (int ck = 0; ck < 3; ++ck)
+            if (row_of[rk] >= 0 && col_of[ck] >= 0)
+                build_class(b, &b->neighbours[3 * rk + ck], row_of[rk], col_of[ck]);
+}
+
+// Set up an empty board, the PRNG state is kept so ms_seed can be called before or not at all.
+// mine_order is cleared, set it afterwards to place the mines from a shuffled list
+void start_new_game(MinesweeperBoard *b, MsLevel level, MsTopology topology) {
+    b->first_move = 1;
+    b->mine_order = NULL;
+    if (b->rng == 0) b->rng = 0xACE1u;
+
+    LevelSpec spec = LEVELS[level];
+    b->cols = spec.cols;
+    b->rows = spec.rows;
+    b->mines = spec.mines;
+    if (b->cols > GRID_MAX_COLS) b->cols = GRID_MAX_COLS;
+    if (b->rows > GRID_MAX_ROWS) b->rows = GRID_MAX_ROWS;
+    b->topology = topology;
+    build_neighbours(b);
+    clear_board_state(b);
+    flood_stop(b);
+    change_reset(b);
+    change_cell(b, 0, 0);              // Whole board is new
+    change_cell(b, b->rows - 1, b->cols - 1);
+
+    // Center cursor
+    b->cursor_r = b->rows / 2;
+    b->cursor_c = b->cols / 2;
+    b->revealed_count = 0;
+    b->flag_count = 0;
+    b->game_over = 0;
+}
@@ -0,0 +1,63 @@
+// Zunjee, Karen, per-frame MMIO access counts and their overlay rows
+#include "mmio.h"
+
+#ifdef PROFILE
+
+#include "sudoku_vga.h"
+
+MmioCount mmio_counts[MMIO_REGION_COUNT];
+static MmioCount last[MMIO_REGION_COUNT];
+static MmioCount peak[MMIO_REGION_COUNT];
+
+// Two-letter labels shown in the overlay, same order as MmioRegion
+static const char *region_labels[MMIO_REGION_COUNT] = {
+    "FB", "DM", "SW", "KY", "TM", "HX"
+};
+
+void mmio_frame_end(void) {
+    for (int r = 0; r < MMIO_REGION_COUNT; r++) {
+        last[r] = mmio_counts[r];
+        if (last[r].reads > peak[r].reads) peak[r].reads = last[r].reads;
+        if (last[r].writes > peak[r].writes) peak[r].writes = last[r].writes;
+        mmio_counts[r].reads = mmio_counts[r].writes = 0;
+    }
+}
+
+const MmioCount *mmio_last(MmioRegion region) {
+    return &last[region];
+}
+
+const MmioCount *mmio_peak(MmioRegion region) {
+    return &peak[region];
+}
+
+const char *mmio_label(MmioRegion region) {
+    return region_labels[region];
+}
+
+// Right-aligned in 6 digits, clamped to 999999, a full frame is 76800 bytes
+static void format6(char *buf, uint32_t v) {
+    if (v > 999999) v = 999999;
+    for (int i = 5; i >= 0; i--) {
+        buf[i] = (i < 5 && v == 0) ? ' ' : (char)('0' + v % 10);
+        v /= 10;
+    }
+}
+
+void mmio_draw_overlay(int x, int y) {
+    draw_rect(x, y, 16 * 8, 8 * MMIO_REGION_COUNT, black);
+
+    for (int r = 0; r < MMIO_REGION_COUNT; r++) {
+        char line[17];
+        for (int i = 0; i < 16; i++) line[i] = ' ';
+        line[0] = region_labels[r][0];
+        line[1] = region_labels[r][1];
+        format6(&line[3], last[r].reads);
+        format6(&line[10], last[r].writes);
+        line[16] = '\0';
+
+        draw_text(x, y + r * 8, line, last[r].reads || last[r].writes ? white : gray);
+    }
+}
+
+#endif
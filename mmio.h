@@ -0,0 +1,116 @@
+// Zunjee, Karen, memory-mapped I/O: every framebuffer and device register access goes through here
+// so profiling builds can count them per frame
+#ifndef MMIO_H
+#define MMIO_H
+
+#include <stdint.h>
+#include "dtekv_board.h"
+
+// Counted with -DPROFILE like the profiling zones, release builds get the bare load or store
+
+// Device regions, the framebuffer is counted in bytes, the registers in accesses
+typedef enum {
+    MMIO_FB,        // VGA framebuffer
+    MMIO_DMA,       // VGA DMA control, one write per present
+    MMIO_SWITCH,    // SW0-SW9
+    MMIO_KEY,       // KEY1
+    MMIO_TIMER,     // Interval timer, the millisecond clock polls it
+    MMIO_HEX,       // Seven-segment displays
+    MMIO_REGION_COUNT
+} MmioRegion;
+
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;
+} MmioCount;
+
+#define MMIO_FB_BASE ((volatile uint8_t *) VGA_Buffer)
+#define HEX_STRIDE 0x10     // HEX0..HEX5 are 16 bytes apart
+#define VGA_DMA_BUFFER 0     // VGA DMA registers, in words: a write swaps the buffers at the next frame
+#define VGA_DMA_BACK 1
+#define VGA_DMA_STATUS 3     // Bit 0 while a swap is pending
+
+#ifdef PROFILE
+extern MmioCount mmio_counts[MMIO_REGION_COUNT];     // Since the last present
+
+void mmio_frame_end(void);                      // Frame handed to the DMA, its counts become the last frame's
+const MmioCount *mmio_last(MmioRegion region);  // Counts of the last presented frame
+const MmioCount *mmio_peak(MmioRegion region);  // Most in any one frame since reset
+const char *mmio_label(MmioRegion region);
+void mmio_draw_overlay(int x, int y);           // One row per region, "LL READS WRITES" of the last frame
+
+#define MMIO_COUNT(region, dir, n) (mmio_counts[region].dir += (uint32_t)(n))
+#define MMIO_FRAME_END() mmio_frame_end()
+#else
+#define MMIO_COUNT(region, dir, n) ((void)(n))     // n still used, the span helpers take it only to count
+#define MMIO_FRAME_END() ((void)0)
+#endif
+
+// Device registers
+static inline uint32_t mmio_switches(void) {
+    MMIO_COUNT(MMIO_SWITCH, reads, 1);
+    return *(volatile uint32_t *) SWITCH_base;
+}
+
+static inline uint32_t mmio_keys(void) {
+    MMIO_COUNT(MMIO_KEY, reads, 1);
+    return *(volatile uint32_t *) KEY1_base;
+}
+
+static inline void mmio_vga_kick(void) {
+    MMIO_COUNT(MMIO_DMA, writes, 1);
+    *(volatile uint32_t *) VGA_DMA = 1;
+}
+
+// Points the VGA DMA at another frame in memory, the framebuffer itself is left to the drawing code.
+// The DMA swaps its buffer and back buffer registers at the next vertical sync, the back buffer is
+// then set again so both hold frame and later kicks keep showing it.
+static inline void mmio_vga_show(const volatile uint8_t *frame) {
+    volatile uint32_t *dma = (volatile uint32_t *) VGA_DMA;
+    MMIO_COUNT(MMIO_DMA, writes, 3);
+    dma[VGA_DMA_BACK] = (uint32_t)(uintptr_t) frame;
+    dma[VGA_DMA_BUFFER] = 1;
+    while (dma[VGA_DMA_STATUS] & 1) MMIO_COUNT(MMIO_DMA, reads, 1);     // Swap pending
+    dma[VGA_DMA_BACK] = (uint32_t)(uintptr_t) frame;
+    SIM_VGA_SHOW(frame);
+}
+
+// Timer registers are 16 bits each in consecutive words
+static inline uint32_t mmio_timer_read(int reg) {
+    MMIO_COUNT(MMIO_TIMER, reads, 1);
+    return ((volatile uint32_t *) TIMER_base)[reg];
+}
+
+static inline void mmio_timer_write(int reg, uint32_t value) {
+    MMIO_COUNT(MMIO_TIMER, writes, 1);
+    ((volatile uint32_t *) TIMER_base)[reg] = value;
+}
+
+static inline void mmio_hex_write(int display, uint32_t segments) {
+    MMIO_COUNT(MMIO_HEX, writes, 1);
+    *(volatile uint32_t *) ((volatile char *) HEX_base + display * HEX_STRIDE) = segments;
+}
+
+// Framebuffer, offset is y * SCREEN_W + x
+static inline uint8_t fb_read(int offset) {
+    MMIO_COUNT(MMIO_FB, reads, 1);
+    return MMIO_FB_BASE[offset];
+}
+
+static inline void fb_write(int offset, uint8_t color) {
+    MMIO_COUNT(MMIO_FB, writes, 1);
+    MMIO_FB_BASE[offset] = color;
+}
+
+// Span about to be read or written through the returned pointer, counted once for all its bytes
+static inline volatile uint8_t *fb_span_read(int offset, int bytes) {
+    MMIO_COUNT(MMIO_FB, reads, bytes);
+    return MMIO_FB_BASE + offset;
+}
+
+static inline volatile uint8_t *fb_span_write(int offset, int bytes) {
+    MMIO_COUNT(MMIO_FB, writes, bytes);
+    return MMIO_FB_BASE + offset;
+}
+
+#endif
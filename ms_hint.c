@@ -0,0 +1,393 @@
+// Karen, mine-probability hints: frontier split into constraint components,
+// exact enumeration for small components and a local estimate for large ones.
+// Only components near the cells changed since the last update are recomputed.
+
+#include <stdint.h>
+#include "ms_hint.h"
+#include "minesweeper.h"
+#include "profile.h"
+#include "arena.h"
+
+// Per-cell maps, sized to the board by hint_alloc
+static uint8_t *hint_prob;                      // Chance of frontier cells, 0..255
+static uint8_t *frontier_bits;                  // Hidden cells next to a revealed number
+static uint16_t *visit;                         // Component stamp of each cell
+static uint16_t stamp, update_base;             // Stamps above update_base belong to this update
+
+static MsChange dirty = {0, 0, -1, -1};         // Region waiting for an update
+static int retry[HINT_RETRY_MAX], nretry;       // A cell of each component to enumerate again
+static int background = 0;                      // Chance of hidden cells away from the frontier
+static int frontier_cells;                      // Frontier bits set
+static int32_t frontier_sum;                    // hint_prob summed over them, mines expected on the frontier
+
+// Component being solved and its search state, frame scratch that lives for one hint_update
+typedef struct {
+    int vars[HINT_MAX_VARS], nvars;
+    int cons[HINT_MAX_CONS], ncons;
+    int need[HINT_MAX_CONS];                    // Mines still missing around each number
+    int cons_vars[HINT_MAX_CONS][8], ncons_vars[HINT_MAX_CONS];
+    int var_cons[HINT_MAX_VARS][8], nvar_cons[HINT_MAX_VARS];
+    int mines_in[HINT_MAX_CONS], unassigned[HINT_MAX_CONS];
+    uint8_t assign[HINT_MAX_VARS];
+    uint32_t sol_count[HINT_MAX_VARS + 1];                  // Solutions by mine count
+    uint32_t var_count[HINT_MAX_VARS][HINT_MAX_VARS + 1];   // Solutions with var as mine, by mine count
+    int nodes_left, aborted;
+} HintSearch;
+
+_Static_assert(sizeof(HintSearch) <= FRAME_ARENA_BYTES, "hint search does not fit the frame arena");
+
+static HintSearch *hs;
+
+static inline int is_frontier(int i) {
+    return (frontier_bits[i >> 3] >> (i & 7)) & 1;
+}
+
+// The running count and sum follow every change, so an update never walks the whole board
+static inline void set_frontier(int i, int on) {
+    if (on == is_frontier(i)) return;
+    if (on) {
+        frontier_bits[i >> 3] |= (uint8_t)(1 << (i & 7));
+        frontier_cells++;
+        frontier_sum += hint_prob[i];
+    } else {
+        frontier_bits[i >> 3] &= (uint8_t)~(1 << (i & 7));
+        frontier_cells--;
+        frontier_sum -= hint_prob[i];
+    }
+}
+
+static inline void set_prob(int i, int chance) {
+    if (is_frontier(i)) frontier_sum += chance - hint_prob[i];
+    hint_prob[i] = (uint8_t)chance;
+}
+
+// Revealed number with at least one hidden neighbour counts as a constraint
+static inline int is_number(const MinesweeperBoard *b, int r, int c) {
+    if (cell_state(b, r, c) != REVEALED) return 0;
+    int n = cell_adj(b, r, c);
+    return n > 0 && n != MINE_CODE;
+}
+
+static int touches_number(const MinesweeperBoard *b, int r, int c) {
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    for (int k = 0; k < nb->count; ++k)
+        if (is_number(b, r + nb->dr[k], c + nb->dc[k])) return 1;
+    return 0;
+}
+
+// Hidden and flagged neighbours of a number
+static void count_around(const MinesweeperBoard *b, int r, int c, int *hidden, int *flagged) {
+    *hidden = *flagged = 0;
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    for (int k = 0; k < nb->count; ++k) {
+        CellState st = cell_state(b, r + nb->dr[k], c + nb->dc[k]);
+        if (st == HIDDEN) (*hidden)++;
+        else if (st == FLAGGED) (*flagged)++;
+    }
+}
+
+// Collect the component around frontier cell start, returns 0 if it is too big to enumerate
+static int collect(const MinesweeperBoard *b, int start) {
+    hs->nvars = hs->ncons = 0;
+    hs->vars[hs->nvars++] = start;
+    visit[start] = stamp;
+
+    for (int q = 0; q < hs->nvars; ++q) {
+        int vr = hs->vars[q] / b->cols, vc = hs->vars[q] % b->cols;
+        const MsNeighbours *vn = cell_neighbours(b, vr, vc);
+        for (int j = 0; j < vn->count; ++j) {
+            int nr = vr + vn->dr[j], nc = vc + vn->dc[j];
+            if (!is_number(b, nr, nc)) continue;
+            int ni = cell_index(b, nr, nc);
+            if (visit[ni] == stamp) continue;
+            if (visit[ni] > update_base || hs->ncons == HINT_MAX_CONS) return 0;   // Joins an oversized component
+            visit[ni] = stamp;
+            hs->cons[hs->ncons++] = ni;
+
+            const MsNeighbours *nn = cell_neighbours(b, nr, nc);
+            for (int e = 0; e < nn->count; ++e) {
+                int ur = nr + nn->dr[e], uc = nc + nn->dc[e];
+                if (cell_state(b, ur, uc) != HIDDEN) continue;
+                int ui = cell_index(b, ur, uc);
+                if (visit[ui] == stamp) continue;
+                if (visit[ui] > update_base || hs->nvars == HINT_MAX_VARS) return 0;
+                visit[ui] = stamp;
+                hs->vars[hs->nvars++] = ui;
+            }
+        }
+    }
+    return 1;
+}
+
+// Wire up constraint <-> variable lists for the collected component
+static void build_links(const MinesweeperBoard *b) {
+    for (int v = 0; v < hs->nvars; ++v) hs->nvar_cons[v] = 0;
+    for (int k = 0; k < hs->ncons; ++k) {
+        int r = hs->cons[k] / b->cols, c = hs->cons[k] % b->cols;
+        int hidden, flagged;
+        count_around(b, r, c, &hidden, &flagged);
+        hs->need[k] = cell_adj(b, r, c) - flagged;
+        hs->ncons_vars[k] = 0;
+        const MsNeighbours *nb = cell_neighbours(b, r, c);
+        for (int j = 0; j < nb->count; ++j) {
+            int rr = r + nb->dr[j], cc = c + nb->dc[j];
+            if (cell_state(b, rr, cc) != HIDDEN) continue;
+            int ui = cell_index(b, rr, cc);
+            for (int v = 0; v < hs->nvars; ++v) {
+                if (hs->vars[v] == ui) {
+                    hs->cons_vars[k][hs->ncons_vars[k]++] = v;
+                    hs->var_cons[v][hs->nvar_cons[v]++] = k;
+                    break;
+                }
+            }
+        }
+        hs->mines_in[k] = 0;
+        hs->unassigned[k] = hs->ncons_vars[k];
+    }
+}
+
+// Depth-first enumeration of every mine layout that satisfies the numbers
+static void search(int v, int k) {
+    if (--hs->nodes_left < 0) {
+        hs->aborted = 1;
+        return;
+    }
+    if (v == hs->nvars) {
+        hs->sol_count[k]++;
+        for (int i = 0; i < hs->nvars; ++i)
+            if (hs->assign[i]) hs->var_count[i][k]++;
+        return;
+    }
+
+    for (int val = 0; val <= 1 && !hs->aborted; ++val) {
+        int ok = 1;
+        for (int j = 0; j < hs->nvar_cons[v]; ++j) {
+            int c = hs->var_cons[v][j];
+            hs->mines_in[c] += val;
+            hs->unassigned[c]--;
+            if (hs->mines_in[c] > hs->need[c] || hs->mines_in[c] + hs->unassigned[c] < hs->need[c]) ok = 0;
+        }
+        if (ok) {
+            hs->assign[v] = (uint8_t)val;
+            search(v + 1, k + val);
+        }
+        for (int j = 0; j < hs->nvar_cons[v]; ++j) {
+            int c = hs->var_cons[v][j];
+            hs->mines_in[c] -= val;
+            hs->unassigned[c]++;
+        }
+    }
+}
+
+// Local estimate for one frontier cell: certain if any neighbour number decides it, else the average
+static int estimate(const MinesweeperBoard *b, int i) {
+    int r = i / b->cols, c = i % b->cols;
+    int sum = 0, n = 0;
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    for (int k = 0; k < nb->count; ++k) {
+        int nr = r + nb->dr[k], nc = c + nb->dc[k];
+        if (!is_number(b, nr, nc)) continue;
+        int hidden, flagged;
+        count_around(b, nr, nc, &hidden, &flagged);
+        int left = cell_adj(b, nr, nc) - flagged;
+        if (left <= 0) return 0;
+        if (left >= hidden) return HINT_CERTAIN;
+        sum += left * HINT_CERTAIN / hidden;
+        n++;
+    }
+    return n ? sum / n : background;
+}
+
+// Layouts with k mines exist and leave a possible mine count for the rest of the board
+static inline int usable(int k, int unknown, int mines_left) {
+    return hs->sol_count[k] && k <= mines_left && unknown - hs->nvars >= mines_left - k;
+}
+
+// Exact chances for the collected component, weighted by how likely each mine count is overall
+static int solve_exact(int unknown, int mines_left) {
+    for (int k = 0; k <= hs->nvars; ++k) {
+        hs->sol_count[k] = 0;
+        for (int v = 0; v < hs->nvars; ++v) hs->var_count[v][k] = 0;
+    }
+    hs->aborted = 0;
+    search(0, 0);
+    if (hs->aborted) return 0;
+
+    int kmin = -1, kmax = -1;
+    for (int k = 0; k <= hs->nvars; ++k) {
+        if (!usable(k, unknown, mines_left)) continue;
+        if (kmin < 0) kmin = k;
+        kmax = k;
+    }
+    if (kmin < 0) return 0;     // Flags contradict the numbers
+
+    // Each extra mine in the component scales a layout by about mines_left / (unknown - mines_left), Q16
+    uint32_t weight[HINT_MAX_VARS + 1];
+    int free_cells = unknown - mines_left;
+    uint32_t ratio = free_cells > 0 ? ((uint32_t)mines_left << 16) / (uint32_t)free_cells : 0xFFFFFFFFu;
+    if (ratio <= (1u << 16)) {
+        weight[kmin] = 1u << 16;
+        for (int k = kmin + 1; k <= kmax; ++k)
+            weight[k] = (uint32_t)(((uint64_t)weight[k - 1] * ratio) >> 16);
+    } else {
+        uint32_t inverse = free_cells > 0 ? ((uint32_t)free_cells << 16) / (uint32_t)mines_left : 0;
+        weight[kmax] = 1u << 16;
+        for (int k = kmax - 1; k >= kmin; --k)
+            weight[k] = (uint32_t)(((uint64_t)weight[k + 1] * inverse) >> 16);
+    }
+
+    uint64_t total = 0;
+    for (int k = kmin; k <= kmax; ++k) {
+        if (!usable(k, unknown, mines_left)) continue;
+        total += (uint64_t)weight[k] * hs->sol_count[k];
+    }
+    int shift = 0;
+    while ((total >> shift) >= (1u << 23)) shift++;     // Keep the final division in 32 bits
+    uint32_t denom = (uint32_t)(total >> shift);
+    if (denom == 0) return 0;
+
+    for (int v = 0; v < hs->nvars; ++v) {
+        uint64_t part = 0;
+        int never = 1, always = 1;
+        for (int k = kmin; k <= kmax; ++k) {
+            if (!usable(k, unknown, mines_left)) continue;
+            part += (uint64_t)weight[k] * hs->var_count[v][k];
+            if (hs->var_count[v][k]) never = 0;
+            if (hs->var_count[v][k] != hs->sol_count[k]) always = 0;
+        }
+        // 0 and HINT_CERTAIN are kept for cells that are decided, rounding never produces them
+        uint32_t chance = (uint32_t)(part >> shift) * HINT_CERTAIN / denom;
+        if (never) chance = 0;
+        else if (always) chance = HINT_CERTAIN;
+        else if (chance == 0) chance = 1;
+        else if (chance >= HINT_CERTAIN) chance = HINT_CERTAIN - 1;
+        set_prob(hs->vars[v], (int)chance);
+    }
+    return 1;
+}
+
+int hint_alloc(Arena *arena, int cells) {
+    hint_prob = arena_alloc(arena, (uint32_t)cells);
+    frontier_bits = arena_alloc(arena, (uint32_t)(cells + 7) / 8);
+    visit = arena_alloc(arena, 2 * (uint32_t)cells);
+    return hint_prob && frontier_bits && visit;
+}
+
+void hint_reset(const MinesweeperBoard *b) {
+    int cells = b->rows * b->cols;
+    for (int i = 0; i < (cells + 7) / 8; ++i) frontier_bits[i] = 0;
+    for (int i = 0; i < cells; ++i) visit[i] = 0;
+    stamp = update_base = 0;
+    nretry = 0;
+    frontier_cells = 0;
+    frontier_sum = 0;
+    background = cells ? b->mines * HINT_CERTAIN / cells : 0;
+    dirty.r0 = 0;
+    dirty.c0 = 0;
+    dirty.r1 = b->rows - 1;
+    dirty.c1 = b->cols - 1;
+}
+
+void hint_note_change(const MsChange *change) {
+    if (change->r0 > change->r1) return;
+    // Numbers next to a changed cell constrain cells one further out
+    int r0 = change->r0 - 2, c0 = change->c0 - 2;
+    int r1 = change->r1 + 2, c1 = change->c1 + 2;
+    if (dirty.r0 > dirty.r1) {
+        dirty.r0 = r0; dirty.c0 = c0; dirty.r1 = r1; dirty.c1 = c1;
+    } else {
+        if (r0 < dirty.r0) dirty.r0 = r0;
+        if (c0 < dirty.c0) dirty.c0 = c0;
+        if (r1 > dirty.r1) dirty.r1 = r1;
+        if (c1 > dirty.c1) dirty.c1 = c1;
+    }
+}
+
+// Enumerate the component of cell i again next update, a full list queues it as a change instead
+static void retry_later(const MinesweeperBoard *b, int i) {
+    if (nretry < HINT_RETRY_MAX) {
+        retry[nretry++] = i;
+        return;
+    }
+    MsChange again = { i / b->cols, i % b->cols, i / b->cols, i % b->cols };
+    hint_note_change(&again);
+}
+
+// Solve the component of cell i unless it is off the frontier or this update already did
+static void solve_component(const MinesweeperBoard *b, int i, int unknown, int mines_left) {
+    if (!is_frontier(i) || visit[i] > update_base) return;
+
+    stamp++;
+    if (collect(b, i)) {
+        build_links(b);
+        if (solve_exact(unknown, mines_left)) return;
+        if (hs->aborted) retry_later(b, i);     // Out of budget this frame: estimate now, enumerate next update
+    }
+    for (int v = 0; v < hs->nvars; ++v) set_prob(hs->vars[v], estimate(b, hs->vars[v]));
+}
+
+void hint_update(const MinesweeperBoard *b) {
+    if (dirty.r0 > dirty.r1 && nretry == 0) return;
+    uint32_t mark = arena_mark(&frame_arena);
+    hs = arena_alloc(&frame_arena, sizeof(HintSearch));
+    if (!hs) return;        // Scratch taken this tick, the dirty region waits for the next update
+    PROF_BEGIN(PROF_HINT_UPDATE);
+
+    // On a torus a region past one edge goes on at the opposite one
+    if (b->topology == MS_TOPO_TORUS) {
+        if (dirty.r0 < 0 || dirty.r1 >= b->rows) { dirty.r0 = 0; dirty.r1 = b->rows - 1; }
+        if (dirty.c0 < 0 || dirty.c1 >= b->cols) { dirty.c0 = 0; dirty.c1 = b->cols - 1; }
+    }
+    int r0 = dirty.r0 < 0 ? 0 : dirty.r0, c0 = dirty.c0 < 0 ? 0 : dirty.c0;
+    int r1 = dirty.r1 >= b->rows ? b->rows - 1 : dirty.r1, c1 = dirty.c1 >= b->cols ? b->cols - 1 : dirty.c1;
+    dirty.r0 = dirty.c0 = 0;
+    dirty.r1 = dirty.c1 = -1;
+    int retries[HINT_RETRY_MAX], nretries = nretry;
+    for (int k = 0; k < nretries; ++k) retries[k] = retry[k];
+    nretry = 0;
+
+    // Whole-board counts for the mine-count weighting and the background chance, kept by the board
+    int unknown = b->rows * b->cols - b->revealed_count - b->flag_count;
+    int mines_left = b->mines - b->flag_count;
+    if (mines_left < 0) mines_left = 0;
+
+    // Frontier membership can only change inside the dirty region
+    for (int r = r0; r <= r1; ++r)
+        for (int c = c0; c <= c1; ++c) {
+            int i = cell_index(b, r, c);
+            set_frontier(i, cell_state(b, r, c) == HIDDEN && touches_number(b, r, c));
+        }
+
+    // Every component takes a stamp, and one has a frontier cell in the region or on the retry list.
+    // Only when the stamps left might run out are they all cleared, between updates so the ones of
+    // components already solved in this update stay valid.
+    int region = r1 < r0 ? 0 : (r1 - r0 + 1) * (c1 - c0 + 1);
+    if (stamp > UINT16_MAX - region - nretries) {
+        for (int i = 0; i < b->rows * b->cols; ++i) visit[i] = 0;
+        stamp = 0;
+    }
+    update_base = stamp;
+    hs->nodes_left = HINT_FRAME_NODES;
+    for (int k = 0; k < nretries; ++k) solve_component(b, retries[k], unknown, mines_left);
+    for (int r = r0; r <= r1; ++r)
+        for (int c = c0; c <= c1; ++c) solve_component(b, cell_index(b, r, c), unknown, mines_left);
+
+    // Mines expected on the frontier are taken out of the count for the rest of the board
+    int rest = unknown - frontier_cells;
+    int32_t left = mines_left * HINT_CERTAIN - frontier_sum;
+    if (left < 0) left = 0;
+    background = rest > 0 ? (int)(left / rest) : 0;
+    // Rounding on the frontier must not make the rest look decided
+    if (background < 1 && mines_left > 0) background = 1;
+    if (background > HINT_CERTAIN - 1) background = HINT_CERTAIN - 1;
+
+    arena_release(&frame_arena, mark);
+    hs = 0;
+    PROF_END(PROF_HINT_UPDATE);
+}
+
+int hint_mine_chance(const MinesweeperBoard *b, int r, int c) {
+    if (cell_state(b, r, c) != HIDDEN) return 0;
+    int i = cell_index(b, r, c);
+    return is_frontier(i) ? hint_prob[i] : background;
+}
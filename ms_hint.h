@@ -0,0 +1,33 @@
+// Karen, live mine-probability hints for minesweeper
+#ifndef MS_HINT_H
+#define MS_HINT_H
+
+#include <stdint.h>
+#include "minesweeper.h"
+#include "arena.h"
+
+#define HINT_MAX_VARS 48        // Frontier cells one component may have and still be enumerated exactly
+#define HINT_MAX_CONS 96        // Revealed numbers one component may touch
+#define HINT_FRAME_NODES 20000  // Search nodes per hint_update, components past the budget get an estimate
+#define HINT_CERTAIN 255        // hint_mine_chance of a known mine
+#define HINT_RETRY_MAX 16       // Components out of budget kept to enumerate again, the rest widen the region
+
+// Hint state is kept for one board at a time
+
+// Per-cell maps for a board of cells cells, taken from arena; 0 if it is full
+#define HINT_ALLOC_BYTES(cells) (ARENA_ROUND(cells) + ARENA_ROUND(2 * (cells)) + ARENA_ROUND(((cells) + 7) / 8))
+int hint_alloc(Arena *arena, int cells);
+
+// Forget everything, call after start_new_game on a board no larger than the last hint_alloc
+void hint_reset(const MinesweeperBoard *b);
+
+// Record the cells changed by the last reveal_cell/toggle_flag (last_change)
+void hint_note_change(const MsChange *change);
+
+// Recompute the components around recorded changes, bounded by HINT_FRAME_NODES
+void hint_update(const MinesweeperBoard *b);
+
+// Mine chance of a hidden cell, 0 (safe) to HINT_CERTAIN, valid after hint_update
+int hint_mine_chance(const MinesweeperBoard *b, int r, int c);
+
+#endif
@@ -0,0 +1,125 @@
+// Zunjee, Karen, profiling zones: ring buffer of cycle samples and on-screen overlay
+#include "profile.h"
+
+#ifdef PROFILE
+
+#include "dtekv_board.h"
+#include "sudoku_vga.h"
+#include "latency.h"
+#include "hud.h"
+#include "mmio.h"
+
+// One measurement of a zone
+typedef struct {
+    uint32_t cycles;
+    uint32_t instret;
+} ProfSample;
+
+// Ring buffer of the latest samples for one zone
+typedef struct {
+    ProfSample ring[PROF_RING_SIZE];
+    int head;       // Next slot to write
+    int count;      // Valid samples, saturates at PROF_RING_SIZE
+    uint32_t start_cycles;
+    uint32_t start_instret;
+} ProfZoneData;
+
+static ProfZoneData zones[PROF_ZONE_COUNT];
+
+// Two-letter labels shown in the overlay, same order as ProfZone
+static const char *zone_labels[PROF_ZONE_COUNT] = {
+    "RB", "SR", "FL", "SI", "IN", "PR", "DL", "HI", "RL", "TR"
+};
+
+void prof_begin(ProfZone zone) {
+    zones[zone].start_instret = read_minstret();
+    zones[zone].start_cycles  = read_mcycle();
+}
+
+void prof_end(ProfZone zone) {
+    uint32_t cycles  = read_mcycle();
+    uint32_t instret = read_minstret();
+    ProfZoneData *z = &zones[zone];
+
+    z->ring[z->head].cycles  = cycles - z->start_cycles;     // Unsigned subtraction handles wrap
+    z->ring[z->head].instret = instret - z->start_instret;
+    z->head = (z->head + 1) % PROF_RING_SIZE;
+    if (z->count < PROF_RING_SIZE) z->count++;
+}
+
+void prof_get_stats(ProfZone zone, ProfStats *out) {
+    const ProfZoneData *z = &zones[zone];
+    uint32_t min = 0xFFFFFFFFu, max = 0;
+    uint32_t sum_cycles = 0, sum_instret = 0;     // 32 samples of up to ~134M cycles fit
+
+    for (int i = 0; i < z->count; i++) {
+        uint32_t c = z->ring[i].cycles;
+        if (c < min) min = c;
+        if (c > max) max = c;
+        sum_cycles  += c;
+        sum_instret += z->ring[i].instret;
+    }
+
+    out->samples = z->count;
+    if (z->count == 0) {
+        out->min_cycles = out->avg_cycles = out->max_cycles = out->avg_instret = 0;
+        return;
+    }
+    out->min_cycles  = min;
+    out->max_cycles  = max;
+    out->avg_cycles  = sum_cycles / (uint32_t)z->count;
+    out->avg_instret = sum_instret / (uint32_t)z->count;
+}
+
+// Write a cycle count as 4 right-aligned digits of kilocycles, clamped to 9999
+static void format_kcycles(char *buf, uint32_t cycles) {
+    uint32_t k = cycles / 1000;
+    if (k > 9999) k = 9999;
+    for (int i = 3; i >= 0; i--) {
+        buf[i] = (i < 3 && k == 0) ? ' ' : (char)('0' + k % 10);
+        k /= 10;
+    }
+}
+
+// Overlay layout: one row per zone, "LL AVG  MIN  MAX" in kilocycles, bottom-left corner.
+// With SW1 as well the MMIO counts of the last frame take the zones' place
+#define OVERLAY_X 0
+#define OVERLAY_Y (SCREEN_H - 8 * PROF_ZONE_COUNT)
+#define OVERLAY_W (18 * 8)
+
+void prof_draw_overlay(void) {
+    uint32_t switches = mmio_switches();
+    static int shown = 0;
+    if (!(switches & (1 << SW_PROF_OVERLAY))) {
+        if (shown) hud_damage(0, OVERLAY_Y, SCREEN_W, SCREEN_H - OVERLAY_Y);    // Status bar comes back from under the tables
+        shown = 0;
+        return;
+    }
+    shown = 1;
+
+    draw_rect(OVERLAY_X, OVERLAY_Y, OVERLAY_W, 8 * PROF_ZONE_COUNT, black);
+    if (switches & (1 << SW_MMIO_OVERLAY)) {
+        mmio_draw_overlay(OVERLAY_X, OVERLAY_Y);
+    } else {
+        for (int zone = 0; zone < PROF_ZONE_COUNT; zone++) {
+            ProfStats st;
+            char line[19];
+            prof_get_stats((ProfZone)zone, &st);
+
+            // "LL AAAA NNNN XXXX"
+            for (int i = 0; i < 18; i++) line[i] = ' ';
+            line[0] = zone_labels[zone][0];
+            line[1] = zone_labels[zone][1];
+            format_kcycles(&line[3],  st.avg_cycles);
+            format_kcycles(&line[8],  st.min_cycles);
+            format_kcycles(&line[13], st.max_cycles);
+            line[18] = '\0';
+
+            draw_text(OVERLAY_X, OVERLAY_Y + zone * 8, line, st.samples ? white : gray);
+        }
+    }
+
+    lat_draw_overlay();     // Input latency table in the opposite corner
+}
+
+#endif
@@ -0,0 +1,84 @@
+// Zunjee, Karen, cycle-counting profiling zones for the DTEKV board
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+// Profiling is only compiled in when building with -DPROFILE, release builds get empty macros
+
+// Code regions that can be measured
+typedef enum {
+    PROF_RENDER_BOARD,   // minesweeper render_board
+    PROF_SUDOKU_RENDER,  // sudoku_render_vga
+    PROF_FLOOD_REVEAL,   // minesweeper flood_reveal
+    PROF_SUDOKU_INIT,    // sudoku_init puzzle generation
+    PROF_INPUT,          // switch and key polling
+    PROF_PRESENT,        // overlay and VGA DMA kick
+    PROF_DL_FLUSH,       // display list sweep into the framebuffer
+    PROF_HINT_UPDATE,    // minesweeper mine-probability hints
+    PROF_RLE_DECODE,     // RLE art expanded into the framebuffer
+    PROF_TRANSITION,     // one tick's share of a screen transition
+    PROF_ZONE_COUNT
+} ProfZone;
+
+#define PROF_RING_SIZE 32      // Samples kept per zone, min/avg/max are taken over this window
+#define SW_PROF_OVERLAY 0      // SW0 shows the overlay while in a game (profiling builds only)
+#define SW_MMIO_OVERLAY 1      // SW1 with SW0 shows the MMIO counts (mmio.h) instead of the zones
+
+// Per-zone statistics over the samples currently in the ring
+typedef struct {
+    uint32_t min_cycles;
+    uint32_t avg_cycles;
+    uint32_t max_cycles;
+    uint32_t avg_instret;
+    int samples;
+} ProfStats;
+
+#ifdef DTEKV_SIM
+uint32_t sim_mcycle(void);     // 30 MHz cycles of host or simulated time, from tools/dtekv_sim.c
+#endif
+
+// Read the RISC-V cycle counter (low 32 bits are enough for deltas)
+static inline uint32_t read_mcycle(void) {
+#if defined(__riscv)
+    uint32_t v;
+    asm volatile("csrr %0, mcycle" : "=r"(v));
+    return v;
+#elif defined(DTEKV_SIM)
+    return sim_mcycle();
+#else
+    return 0;
+#endif
+}
+
+// Read the RISC-V retired instruction counter
+static inline uint32_t read_minstret(void) {
+#if defined(__riscv)
+    uint32_t v;
+    asm volatile("csrr %0, minstret" : "=r"(v));
+    return v;
+#else
+    return 0;
+#endif
+}
+
+#ifdef PROFILE
+void prof_begin(ProfZone zone);
+void prof_end(ProfZone zone);
+void prof_get_stats(ProfZone zone, ProfStats *out);
+void prof_draw_overlay(void);
+
+#define PROF_BEGIN(zone) prof_begin(zone)
+#define PROF_END(zone)   prof_end(zone)
+// Scoped marker, measures the statement or block that follows it
+#define PROF_SCOPE(zone) \
+    for (int prof_once_ = (prof_begin(zone), 1); prof_once_; prof_once_ = (prof_end(zone), 0))
+#define PROF_OVERLAY()   prof_draw_overlay()
+#else
+#define PROF_BEGIN(zone) ((void)0)
+#define PROF_END(zone)   ((void)0)
+#define PROF_SCOPE(zone)
+#define PROF_OVERLAY()   ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,48 @@
+// Zunjee, Karen, streaming RLE decoder: runs are span fills a word at a time, literals byte copies
+#include "rle.h"
+#include "dtekv_board.h"
+#include "profile.h"
+#include "mmio.h"
+
+// n pixels of one color from p, aligned words in the middle
+static void fill_span(volatile uint8_t *p, int n, uint8_t color) {
+    while (n > 0 && ((uintptr_t)p & 3)) {
+        *p++ = color;
+        n--;
+    }
+    uint32_t word = color * 0x01010101u;
+    volatile uint32_t *w = (volatile uint32_t *)p;
+    for (; n >= 4; n -= 4) *w++ = word;
+    p = (volatile uint8_t *)w;
+    while (n-- > 0) *p++ = color;
+}
+
+void rle_draw(const RleImage *img, int x, int y) {
+    PROF_BEGIN(PROF_RLE_DECODE);
+    const uint8_t *s = img->data;
+    for (int row = 0; row < img->h; row++) {
+        int sy = y + row;
+        int visible = sy >= 0 && sy < SCREEN_H;
+        for (int col = 0; col < img->w;) {
+            int op = *s++;
+            int n = op < 0x80 ? op + 1 : op - 0x7F;
+            int x0 = x + col, x1 = x0 + n;
+            int skip = 0;                                   // Clipped pixels at the left of the op
+            if (x0 < 0) { skip = -x0; x0 = 0; }
+            if (x1 > SCREEN_W) x1 = SCREEN_W;
+            if (op < 0x80) {
+                uint8_t color = *s++;
+                if (visible && x0 < x1 && color != img->key)
+                    fill_span(fb_span_write(sy * SCREEN_W + x0, x1 - x0), x1 - x0, color);
+            } else {
+                if (visible && x0 < x1) {
+                    volatile uint8_t *p = fb_span_write(sy * SCREEN_W + x0, x1 - x0);
+                    for (int i = 0; i < x1 - x0; i++) p[i] = s[skip + i];
+                }
+                s += n;
+            }
+            col += n;
+        }
+    }
+    PROF_END(PROF_RLE_DECODE);
+}
@@ -0,0 +1,25 @@
+// Zunjee, Karen, run-length encoded RGB332 art: full-screen backgrounds and small sprites in ROM,
+// expanded straight into the framebuffer. The streams are made by tools/rle_pack from PPM images
+#ifndef RLE_H
+#define RLE_H
+
+#include <stdint.h>
+
+// Stream format, one row after another and no op crosses a row end:
+//   0x00-0x7F  run, the next byte repeated (op + 1) times
+//   0x80-0xFF  literal, the next (op - 0x7F) bytes copied
+// Pixels in the key color are always in runs, so a sprite's transparent runs are skipped whole
+#define RLE_MAX_RUN 128
+#define RLE_NO_KEY (-1)
+
+typedef struct {
+    uint16_t w, h;
+    int16_t key;            // Transparent RGB332 color, RLE_NO_KEY for opaque images
+    uint32_t size;          // Bytes in data
+    const uint8_t *data;
+} RleImage;
+
+// Decode at (x, y), clipped to the screen, runs become span fills
+void rle_draw(const RleImage *img, int x, int y);
+
+#endif
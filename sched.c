@@ -0,0 +1,71 @@
+// Zunjee, Karen, cooperative scheduler, ticks are timed by timer.h
+#include <stdint.h>
+#include "sched.h"
+#include "timer.h"
+#include "dtekv_board.h"
+#include "arena.h"
+
+#define SPIN_LOOPS 1000         // Waiting in steps of roughly 0.1 ms
+
+static SchedIdle idle_tasks[SCHED_MAX_IDLE];
+static int idle_count = 0;
+static int idle_next = 0;       // Round robin, no task starves the others
+static int hurry = 0;
+
+void sched_add_idle(SchedIdle task) {
+    if (idle_count < SCHED_MAX_IDLE) idle_tasks[idle_count++] = task;
+}
+
+void sched_hurry(void) {
+    hurry = 1;
+}
+
+static void spin(volatile int loops) {
+    SIM_IDLE(loops);
+    while (loops-- > 0) {
+        asm volatile("nop");
+    }
+}
+
+// Run background slices until the tick is due or no task has work, then wait out the rest
+static void idle_until(uint32_t due) {
+    int idle_tasks_done = 0;
+    while ((int32_t)(timer_ms() - due) < 0) {
+        if (idle_tasks_done < idle_count) {
+            SchedIdle task = idle_tasks[idle_next];
+            idle_next = (idle_next + 1) % idle_count;
+            idle_tasks_done = task() ? 0 : idle_tasks_done + 1;     // Stop after a full round with no work
+        } else {
+            spin(SPIN_LOOPS);
+        }
+    }
+}
+
+void sched_run(const SchedState *states, int first) {
+    int current = first;
+    states[current].enter();
+    uint32_t due = timer_ms();
+
+    for (;;) {
+        arena_reset(&frame_arena);      // Scratch never outlives a tick
+        if (transition_running()) transition_step();   // Before update, a KEY1 press finishes it
+        int next = states[current].update();
+        if (next == current) {
+            if (!transition_running()) states[current].render();    // Held back until the screen is in
+        } else {
+            current = next;             // The new state draws its own screen, off screen until it is in
+            transition_begin(states[current].transition);
+            states[current].enter();
+        }
+
+        due += SCHED_TICK_MS;
+        if (hurry) {
+            hurry = 0;
+            due = timer_ms();
+        } else if ((int32_t)(timer_ms() - due) > SCHED_TICK_MS) {
+            due = timer_ms();       // Far behind after a long tick, do not try to catch up
+        } else {
+            idle_until(due);
+        }
+    }
+}
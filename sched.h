@@ -0,0 +1,26 @@
+// Zunjee, Karen, cooperative scheduler: the menu and the games are states ticked at a fixed rate,
+// background tasks fill the time left over in each tick
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "transition.h"
+
+#define SCHED_TICK_MS 2         // One update and render per tick
+#define SCHED_MAX_IDLE 4        // Background tasks
+
+// A screen of the program, every callback returns quickly and keeps its state between ticks
+typedef struct {
+    void (*enter)(void);        // Becomes the current state, draws nothing until render
+    int (*update)(void);        // Input and logic for one tick, returns the state to run next
+    void (*render)(void);       // Draws and presents what update changed, if anything
+    TransitionKind transition;  // How its screen replaces the last one when another state hands over
+} SchedState;
+
+// Background task: does one short slice of work, returns 0 when it has nothing left to do
+typedef int (*SchedIdle)(void);
+
+void sched_add_idle(SchedIdle task);
+void sched_hurry(void);         // The current state has work queued, start the next tick without idling
+void sched_run(const SchedState *states, int first);    // Never returns
+
+#endif
@@ -0,0 +1,56 @@
+// Zunjee, Karen, save-under sprites, perimeter copies straight to and from the framebuffer
+#include "sprite.h"
+#include "dtekv_board.h"
+#include "mmio.h"
+
+#define SPRITE_SAVE 0
+#define SPRITE_RESTORE 1
+#define SPRITE_DRAW 2
+
+static inline void visit(Sprite *s, int op, int x, int y, int i) {
+    if (x < 0 || x >= SCREEN_W || y < 0 || y >= SCREEN_H) return;
+    int offset = y * SCREEN_W + x;
+    switch (op) {
+        case SPRITE_SAVE:    s->under[i] = fb_read(offset); break;
+        case SPRITE_RESTORE: fb_write(offset, s->under[i]); break;
+        default:             fb_write(offset, s->color); break;
+    }
+}
+
+// Every pixel of the frame once, in the order of under[]
+static void perimeter(Sprite *s, int op) {
+    int i = 0;
+    for (int dx = 0; dx < s->w; dx++) visit(s, op, s->x + dx, s->y, i++);
+    if (s->h > 1)
+        for (int dx = 0; dx < s->w; dx++) visit(s, op, s->x + dx, s->y + s->h - 1, i++);
+    for (int dy = 1; dy < s->h - 1; dy++) {
+        visit(s, op, s->x, s->y + dy, i++);
+        if (s->w > 1) visit(s, op, s->x + s->w - 1, s->y + dy, i++);
+    }
+}
+
+void sprite_show(Sprite *s, int x, int y, int w, int h, uint8_t color) {
+    if (w > SPRITE_MAX_SIDE) w = SPRITE_MAX_SIDE;
+    if (h > SPRITE_MAX_SIDE) h = SPRITE_MAX_SIDE;
+    if (s->shown && s->x == x && s->y == y && s->w == w && s->h == h && s->color == color) return;
+    sprite_hide(s);
+    s->x = (int16_t)x;
+    s->y = (int16_t)y;
+    s->w = (int16_t)w;
+    s->h = (int16_t)h;
+    s->color = color;
+    if (w <= 0 || h <= 0) return;
+    perimeter(s, SPRITE_SAVE);
+    perimeter(s, SPRITE_DRAW);
+    s->shown = 1;
+}
+
+void sprite_hide(Sprite *s) {
+    if (!s->shown) return;
+    perimeter(s, SPRITE_RESTORE);
+    s->shown = 0;
+}
+
+void sprite_forget(Sprite *s) {
+    s->shown = 0;
+}
@@ -0,0 +1,29 @@
+// Zunjee, Karen, save-under sprites: one pixel frames drawn straight into a finished frame,
+// the pixels beneath are kept so a move or hide puts them back without redrawing any cell
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+
+#define SPRITE_MAX_SIDE 64                          // Widest and tallest frame, the 4x4 Sudoku cell is 54
+#define SPRITE_MAX_PERIMETER (4 * SPRITE_MAX_SIDE)
+
+// A frame sprite, owned by the game that shows it
+typedef struct {
+    int16_t x, y, w, h;
+    uint8_t color;
+    uint8_t shown;                          // On screen, under holds what it covers
+    uint8_t under[SPRITE_MAX_PERIMETER];    // Top row, bottom row, then left and right columns
+} Sprite;
+
+// Draw the frame at (x, y), putting back what the sprite covered before if it was shown elsewhere.
+// Call after dl_flush, the saved pixels are read from the framebuffer
+void sprite_show(Sprite *s, int x, int y, int w, int h, uint8_t color);
+
+// Put back the pixels under the sprite, before anything is drawn over or scrolled under it
+void sprite_hide(Sprite *s);
+
+// The screen under the sprite is being redrawn whole, drop the saved pixels without writing them
+void sprite_forget(Sprite *s);
+
+#endif
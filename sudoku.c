@@ -2,198 +2,115 @@
 #include "sudoku.h" 
 #include "sudoku_puzzles.h" // Include predefined puzzles, remove when using VGA
 #include <stdio.h> // For testing, remove when using VGA
-#include <stdlib.h> // For rand()
+#include <stdint.h> // For the value masks
 #include <string.h> // For memset (used to set a block of memory to a specific value, typically zero)
 #include "dtekv_board.h"
-
-// shuffle function to randomize puzzle selection, row/column swaps, and number permutations
-void swap_rows(int grid[9][9], int row1, int row2) {  
-    for (int col = 0; col < 9; col++) { 
-        int temp = grid[row1][col]; 
-        grid[row1][col] = grid[row2][col]; 
-        grid[row2][col] = temp; 
-    }
-}
-
-// Function to swap columns, used in shuffling the grid
-void swap_cols(int grid[9][9], int col1, int col2) { 
-    for (int row = 0; row < 9; row++) {
-        int temp = grid[row][col1];
-        grid[row][col1] = grid[row][col2];
-        grid[row][col2] = temp;
-    }
-}
-
-// Function to shuffle rows within each band (set of 3 rows), used in generating puzzles
-void shuffle_rows(int grid[9][9]) { 
-    for (int band = 0; band < 3; band++) {
-        int base = band * 3;
-        for (int i = 0; i < 3; i++) {
-            int j = rand() % 3;
-            swap_rows(grid, base + i, base + j);
-        }
-    }
+#include "profile.h"
+#include "arena.h"
+#include "sudoku_hint.h"
+
+// Generator state, only sudoku_init and sudoku_transform draw from it, so a puzzle ID gives the
+// same puzzle on the board and in the host tools whatever rand() they have
+static uint32_t sdk_rng;
+
+static uint32_t sdk_rand(void) {
+    uint32_t r = sdk_rng;
+    r ^= (r << 13);
+    r ^= (r >> 17);
+    r ^= (r << 5);
+    sdk_rng = r;
+    return r;
 }
 
-// Function to shuffle columns within each stack (set of 3 columns), used in generating puzzles
-void shuffle_cols(int grid[9][9]) { 
-    for (int stack = 0; stack < 3; stack++) {
-        int base = stack * 3;
-        for (int i = 0; i < 3; i++) {
-            int j = rand() % 3;
-            swap_cols(grid, base + i, base + j);
-        }
-    }
+// Murmur3 finalizer, nearby seeds start far apart
+static void sdk_seed(uint32_t seed, uint32_t salt) {
+    uint32_t h = seed ^ (salt * 0x9E3779B9u);
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    sdk_rng = h ? h : 0x6D2B79F5u;     // xorshift state must not be zero
 }
 
-// Function to permute numbers in the grid, maps 1-9 to a random permutation of 1-9
-void permute_numbers(int grid[9][9]) {
-    int map[10] = {0};  // map[0] unused, map[1-9] will hold the permutation
-    for (int i = 1; i <= 9; i++) map[i] = i;    // Initialize map to identity
-    for (int i = 1; i <= 9; i++) {  // Shuffle the map array 
-        int j = 1 + rand() % 9; 
-        int tmp = map[i];   
-        map[i] = map[j];
-        map[j] = tmp;
+// Specialized logic for each grid size, loops and masks are constant per size
+#define SUDOKU_B 2
+#define SUDOKU_N 4
+#include "sudoku_order.h"
+
+#define SUDOKU_B 3
+#define SUDOKU_N 9
+#include "sudoku_order.h"
+
+#define SUDOKU_B 4
+#define SUDOKU_N 16
+#include "sudoku_order.h"
+
+// Function to initialize the Sudoku game, the same base, difficulty and size give the same puzzle
+void sudoku_init(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint16_t base) {
+    PROF_BEGIN(PROF_SUDOKU_INIT);
+    sdk_seed(base, (uint32_t)difficulty * 8 + (uint32_t)order + 1);
+    switch (order) {
+        case SUDOKU_4X4:   sudoku_init_4(game, difficulty); break;
+        case SUDOKU_16X16: sudoku_init_16(game, difficulty); break;
+        default:           sudoku_init_9(game, difficulty); break;
     }
-    for (int r = 0; r < 9; r++) // Apply the permutation to the grid
-        for (int c = 0; c < 9; c++)       // Replace each number with its mapped value
-            grid[r][c] = map[grid[r][c]];   // 1-9 are permuted
+    game->id = base;
+    PROF_END(PROF_SUDOKU_INIT);
 }
 
+_Static_assert(sizeof(Transform_16) + 2 * 16 * 16 <= FRAME_ARENA_BYTES, "transform scratch does not fit the frame arena");
 
-// Function to remove cells from the grid to create the difficulty level of the puzzle
-void remove_cells(int grid[9][9], int cells_to_remove) {
-    int removed = 0;
-    while (removed < cells_to_remove) {
-        int r = rand() % 9;
-        int c = rand() % 9;
-        if (grid[r][c] != 0) {
-            grid[r][c] = 0;
-            removed++;
-        }
+// Symmetry picked by variant, applied to a game from the pool or a fresh sudoku_init
+void sudoku_transform(SudokuGame *game, uint16_t variant) {
+    sdk_seed(variant, 0x100u + (uint32_t)game->order);
+    switch (game->order) {
+        case SUDOKU_4X4:   sudoku_transform_4(game); break;
+        case SUDOKU_16X16: sudoku_transform_16(game); break;
+        default:           sudoku_transform_9(game); break;
     }
+    game->id = SUDOKU_ID(game->id, variant);
 }
 
-// Function to initialize the Sudoku game
-void sudoku_init(SudokuGame *game, SudokuDifficulty difficulty) {
-    memset(game, 0, sizeof(SudokuGame)); // Clear the game structure, set all values to 0
-    game->difficulty = difficulty; // Set the difficulty level
-    game->state = GAME_RUNNING; // Set initial game state to running
-    game->selected_row = 0;     // Start with the first cell selected, top-left corner
-    game->selected_col = 0;
-
-    int puzzle[9][9];   // Temporary puzzle grid
-    memcpy(puzzle, solved_grid, sizeof(solved_grid)); // Start with a solved grid
-    shuffle_rows(puzzle);   
-    shuffle_cols(puzzle);
-    permute_numbers(puzzle);
-    memcpy (game->solution, puzzle, sizeof(puzzle)); // Save the solution before removing cells
-
-    int cells_to_remove;    // Determine number of cells to remove based on difficulty
-    if (difficulty == EASY) {
-        cells_to_remove = 35;
-    } else if (difficulty == MEDIUM) {
-        cells_to_remove = 45;
-    } else {
-        cells_to_remove = 55;
-    }
-    remove_cells(puzzle, cells_to_remove);  // Remove cells to create the puzzle
-
-    for (int r = 0; r < 9; r++) {   // Copy the puzzle into the game grid
-        for (int c = 0; c < 9; c++) {   // Set cell value and fixed status
-            int value = puzzle[r][c];   // 0 if empty
-            game->grid.cells[r][c].value = value;   // Set cell value
-            if (value != 0) {   // If the cell is part of the initial puzzle
-                game->grid.cells[r][c].fixed = 1;   // Mark as fixed
-            } else {    
-                game->grid.cells[r][c].fixed = 0;   // Else, mark as not fixed
-            }
-        }
-    }
+void sudoku_generate(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint32_t id) {
+    sudoku_init(game, difficulty, order, SUDOKU_ID_BASE(id));
+    sudoku_transform(game, SUDOKU_ID_VARIANT(id));
 }
 
 // Function to check if the player has won or lost, returns 1 if won, 0 otherwise
 int sudoku_check_win(SudokuGame *game) {
-    int row, col;
-    int filled = 1;
-
-    // First, check if the board is completely filled
-    for (row = 0; row < SUDOKU_SIZE; row++) {
-        for (col = 0; col < SUDOKU_SIZE; col++) {
-            if (game->grid.cells[row][col].value == 0) {
-                filled = 0;
-                break;
-            }
-        }
-        if (!filled) break;
-    }
-
-    // If board is not full, just keep playing
-    if (!filled) {
-        return 0;
-    }
-
-    // Board is full → now check rows, columns, and boxes for validity
-    for (row = 0; row < SUDOKU_SIZE; row++) {
-        int row_seen[10] = {0};
-        int col_seen[10] = {0};
-        for (col = 0; col < SUDOKU_SIZE; col++) {
-            int val_row = game->grid.cells[row][col].value;
-            int val_col = game->grid.cells[col][row].value;
-
-            if (row_seen[val_row] || col_seen[val_col]) {
-                game->state = GAME_LOST;
-                return 0;
-            }
-            row_seen[val_row] = 1;
-            col_seen[val_col] = 1;
-        }
-    }
-
-    // Check 3x3 boxes
-    for (int box_row = 0; box_row < 3; box_row++) {
-        for (int box_col = 0; box_col < 3; box_col++) {
-            int seen[10] = {0};
-            for (int r = 0; r < 3; r++) {
-                for (int c = 0; c < 3; c++) {
-                    int val = game->grid.cells[box_row*3+r][box_col*3+c].value;
-                    if (seen[val]) {
-                        game->state = GAME_LOST;
-                        return 0;
-                    }
-                    seen[val] = 1;
-                }
-            }
-        }
+    switch (game->order) {
+        case SUDOKU_4X4:   return sudoku_check_win_4(game);
+        case SUDOKU_16X16: return sudoku_check_win_16(game);
+        default:           return sudoku_check_win_9(game);
     }
-
-    // If we reach here, board is full and valid
-    game->state = GAME_WON;
-    return 1;
 }
 
 int sudoku_is_full(const SudokuGame *game) {
-    for (int row = 0; row < SUDOKU_SIZE; ++row)
-        for (int col = 0; col < SUDOKU_SIZE; ++col)
-            if (game->grid.cells[row][col].value == 0)
-                return 0;
-    return 1;
+    switch (game->order) {
+        case SUDOKU_4X4:   return sudoku_is_full_4(game);
+        case SUDOKU_16X16: return sudoku_is_full_16(game);
+        default:           return sudoku_is_full_9(game);
+    }
 }
 
 // For testing purposes, prints the Sudoku grid to console
 void print_sudoku(SudokuGame *game) {
-    for (int r = 0; r < 9; r++) {
-        for (int c = 0; c < 9; c++) {
+    int n = game->size, b = game->order;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
             int v = game->grid.cells[r][c].value;
             if (v == 0)
                 printf(". ");
             else
                 printf("%d ", v);
-            if ((c + 1) % 3 == 0 && c != 8) printf("| ");
+            if ((c + 1) % b == 0 && c != n - 1) printf("| ");
         }
         printf("\n");
-        if ((r + 1) % 3 == 0 && r != 8) printf("------+-------+------\n");
+        if ((r + 1) % b == 0 && r != n - 1) {
+            for (int c = 0; c < n; c++) printf(((c + 1) % b == 0 && c != n - 1) ? "--+-" : "--");
+            printf("\n");
+        }
     }
 }
 
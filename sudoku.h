@@ -1,15 +1,30 @@
 // Zunjee, header file for sudoku.c
 #ifndef SUDOKU_H    //  correct and prevents multiple inclusions
 #define SUDOKU_H    // SUDOKU_H, a unique identifier for this header file
-#define SUDOKU_SIZE 9  // Define the size of the Sudoku grid
+#include <stdint.h>
+#define SUDOKU_MAX_SIZE 16  // Largest grid, 16x16, storage is always this size
+#define SUDOKU_NOTES_MAX_SIZE 9     // Pencil marks need a readable mini digit, 16x16 cells are too small
+
+typedef enum {  // Grid order, the box side length, the grid is order^2 cells wide
+    SUDOKU_4X4 = 2,
+    SUDOKU_9X9 = 3,
+    SUDOKU_16X16 = 4
+} SudokuOrder;
+
+// Per-order code is generated by including sudoku_order.h / sudoku_vga_order.h with
+// SUDOKU_B and SUDOKU_N defined, SUDOKU_SPECIALIZE(name) gives name_4, name_9 or name_16
+#define SUDOKU_CAT_(name, n) name##_##n
+#define SUDOKU_CAT(name, n) SUDOKU_CAT_(name, n)
+#define SUDOKU_SPECIALIZE(name) SUDOKU_CAT(name, SUDOKU_N)
 
 typedef struct {
     int value; // Value of the cell (0 if empty)
     int fixed; // 1 if the cell is part of the initial puzzle, 0 otherwise
+    uint16_t notes; // Pencil marks, bit d-1 set = candidate d, shown while the cell is empty
 } SudokuCell;
 
 typedef struct {
-    SudokuCell cells[SUDOKU_SIZE][SUDOKU_SIZE]; // 9x9 grid of Sudoku cells
+    SudokuCell cells[SUDOKU_MAX_SIZE][SUDOKU_MAX_SIZE]; // Only the top-left size x size cells are used
 } SudokuGrid;
 
 typedef enum {  // Enum for difficulty levels
@@ -30,25 +45,46 @@ typedef enum {  // Enum for input actions
     INPUT_DOWN, 
     INPUT_LEFT, 
     INPUT_RIGHT, 
-    INPUT_INCREMENT, // Increment cell value (SW9)
-    INPUT_ERASE,     // Erase cell value (SW8)
-    INPUT_ENTER,   
+    INPUT_INCREMENT, // Increment cell value (SW9), next note digit in notes mode
+    INPUT_ERASE,     // Erase cell value (SW8), and its notes in notes mode
+    INPUT_ENTER,     // Plain KEY1, toggles the note digit in notes mode, a hint otherwise
+    INPUT_NOTES,     // Notes mode on/off (SW8 + SW9)
     INPUT_EXIT,
 } InputAction; 
 
 
+// Digits placed in every row, column and box, kept up to date by sudoku_update for the hints (sudoku_hint.h)
+typedef struct {
+    uint8_t count[3][SUDOKU_MAX_SIZE][SUDOKU_MAX_SIZE + 1];  // [row, column or box][unit][digit]
+    uint16_t used[3][SUDOKU_MAX_SIZE];                       // Bit d-1 set while digit d is in the unit
+} SudokuUnits;
+
 typedef struct {
     SudokuGrid grid; // The Sudoku grid
-    int solution[SUDOKU_SIZE][SUDOKU_SIZE]; // The solution grid for validation
+    int solution[SUDOKU_MAX_SIZE][SUDOKU_MAX_SIZE]; // The solution grid for validation
+    SudokuOrder order; // Box side length, picks the specialized logic and renderer
+    int size; // Cells per row, order * order
     int selected_row; // Currently selected row
     int selected_col; // Currently selected column
     GameState state; // Current game state
+    int notes_mode; // KEY1 edits pencil marks instead of the digit
+    int note_digit; // Candidate the next plain KEY1 toggles, 1-size
+    SudokuUnits units; // What the hint engine works from
     double elapsed_time; // Time elapsed since the start of the game
     int difficulty; // Difficulty level, 0 = easy, 1 = medium, 2 = hard
+    uint32_t id; // Puzzle ID, with the difficulty and size it gives this puzzle again
 } SudokuGame;
 
+// Puzzle IDs: the low half seeds sudoku_init, which the game pool runs ahead of time, the high
+// half the symmetry sudoku_transform applies at the start
+#define SUDOKU_ID_BASE(id) ((uint16_t)(id))
+#define SUDOKU_ID_VARIANT(id) ((uint16_t)((id) >> 16))
+#define SUDOKU_ID(base, variant) (((uint32_t)(variant) << 16) | (uint16_t)(base))
+
 // Logic functions
-void sudoku_init(SudokuGame *game, SudokuDifficulty difficulty); 
+void sudoku_init(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint16_t base);
+void sudoku_transform(SudokuGame *game, uint16_t variant);   // Symmetry of a generated game: lines, bands, transpose, digits
+void sudoku_generate(SudokuGame *game, SudokuDifficulty difficulty, SudokuOrder order, uint32_t id);    // Both, the whole ID
 void sudoku_update(SudokuGame *game, InputAction action);
 int sudoku_check_win(SudokuGame *game);
 int sudoku_is_full(const SudokuGame *game);
@@ -0,0 +1,254 @@
+// Zunjee, Sudoku hint engine: unit counts kept incrementally, singles found on the candidate
+// masks, pointing and naked pairs only run when no single is left
+#include "sudoku_hint.h"
+
+#define UNIT_ROW 0
+#define UNIT_COL 1
+#define UNIT_BOX 2
+
+// Candidates of one search, eliminations only ever clear bits
+typedef struct {
+    uint16_t cand[SUDOKU_MAX_SIZE * SUDOKU_MAX_SIZE];   // Row major, size is the stride, 0 for filled cells
+    int n, b;
+} HintWork;
+
+static const char *technique_names[TECH_COUNT] = {
+    "NO HINT", "NAKED SINGLE", "HIDDEN SINGLE", "POINTING PAIR", "NAKED PAIR", "CONFLICT"
+};
+
+static inline int popcount16(unsigned m) {
+    int n = 0;
+    while (m) {
+        m &= m - 1;
+        n++;
+    }
+    return n;
+}
+
+static inline int lowest_digit(unsigned m) {
+    int d = 1;
+    while (!(m & 1)) {
+        m >>= 1;
+        d++;
+    }
+    return d;
+}
+
+// Cell index of the k-th cell of a unit
+static inline int unit_cell(int n, int b, int kind, int unit, int k) {
+    switch (kind) {
+        case UNIT_ROW: return unit * n + k;
+        case UNIT_COL: return k * n + unit;
+        default:       return ((unit / b) * b + k / b) * n + (unit % b) * b + k % b;
+    }
+}
+
+static void count_digit(SudokuGame *game, int row, int col, int digit, int delta) {
+    if (digit == 0) return;
+    SudokuUnits *u = &game->units;
+    int unit[3] = { row, col, (row / game->order) * game->order + col / game->order };
+    for (int kind = 0; kind < 3; kind++) {
+        uint8_t *count = &u->count[kind][unit[kind]][digit];
+        *count = (uint8_t)(*count + delta);
+        if (*count) u->used[kind][unit[kind]] |= (uint16_t)(1u << (digit - 1));
+        else        u->used[kind][unit[kind]] &= (uint16_t)~(1u << (digit - 1));
+    }
+}
+
+void sudoku_hint_reset(SudokuGame *game) {
+    SudokuUnits *u = &game->units;
+    for (int kind = 0; kind < 3; kind++) {
+        for (int unit = 0; unit < SUDOKU_MAX_SIZE; unit++) {
+            u->used[kind][unit] = 0;
+            for (int d = 0; d <= SUDOKU_MAX_SIZE; d++) u->count[kind][unit][d] = 0;
+        }
+    }
+    for (int r = 0; r < game->size; r++)
+        for (int c = 0; c < game->size; c++)
+            count_digit(game, r, c, game->grid.cells[r][c].value, 1);
+}
+
+void sudoku_hint_note(SudokuGame *game, int row, int col, int old_value) {
+    count_digit(game, row, col, old_value, -1);
+    count_digit(game, row, col, game->grid.cells[row][col].value, 1);
+}
+
+// A digit twice in a unit, pointed at the copy the player entered when there is one
+static int find_conflict(const SudokuGame *game, SudokuHint *hint) {
+    const SudokuUnits *u = &game->units;
+    int n = game->size, b = game->order;
+    for (int kind = 0; kind < 3; kind++) {
+        for (int unit = 0; unit < n; unit++) {
+            for (int d = 1; d <= n; d++) {
+                if (u->count[kind][unit][d] < 2) continue;
+                for (int k = 0; k < n; k++) {
+                    int i = unit_cell(n, b, kind, unit, k);
+                    const SudokuCell *cell = &game->grid.cells[i / n][i % n];
+                    if (cell->value != d || cell->fixed) continue;
+                    hint->row = i / n;
+                    hint->col = i % n;
+                    hint->technique = TECH_CONFLICT;
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static void work_init(HintWork *w, const SudokuGame *game) {
+    const SudokuUnits *u = &game->units;
+    int n = game->size, b = game->order;
+    uint16_t full = (uint16_t)((1u << n) - 1u);
+    w->n = n;
+    w->b = b;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            uint16_t taken = u->used[UNIT_ROW][r] | u->used[UNIT_COL][c] | u->used[UNIT_BOX][(r / b) * b + c / b];
+            w->cand[r * n + c] = game->grid.cells[r][c].value ? 0 : (uint16_t)(full & ~taken);
+        }
+    }
+}
+
+static int naked_single(const HintWork *w, SudokuHint *hint) {
+    for (int i = 0; i < w->n * w->n; i++) {
+        if (popcount16(w->cand[i]) != 1) continue;     // Filled cells have no candidates
+        hint->row = i / w->n;
+        hint->col = i % w->n;
+        hint->digit = lowest_digit(w->cand[i]);
+        hint->technique = TECH_NAKED_SINGLE;
+        return 1;
+    }
+    return 0;
+}
+
+static int hidden_single(const HintWork *w, const SudokuGame *game, SudokuHint *hint) {
+    int n = w->n, b = w->b;
+    for (int kind = 0; kind < 3; kind++) {
+        for (int unit = 0; unit < n; unit++) {
+            // Digits seen once and more than once in the unit's candidates
+            unsigned once = 0, twice = 0;
+            for (int k = 0; k < n; k++) {
+                unsigned m = w->cand[unit_cell(n, b, kind, unit, k)];
+                twice |= once & m;
+                once |= m;
+            }
+            unsigned single = once & ~twice & ~game->units.used[kind][unit];
+            if (!single) continue;
+            unsigned bit = single & -single;
+            for (int k = 0; k < n; k++) {
+                int i = unit_cell(n, b, kind, unit, k);
+                if (!(w->cand[i] & bit)) continue;
+                hint->row = i / n;
+                hint->col = i % n;
+                hint->digit = lowest_digit(bit);
+                hint->technique = TECH_HIDDEN_SINGLE;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Clear bits from the cells of a row or column outside box skip_box, 1 if any changed
+static int eliminate_line(HintWork *w, int kind, int line, int skip_box, uint16_t bits) {
+    int n = w->n, b = w->b, changed = 0;
+    for (int k = 0; k < n; k++) {
+        int i = unit_cell(n, b, kind, line, k);
+        int r = i / n, c = i % n;
+        if ((r / b) * b + c / b == skip_box || !(w->cand[i] & bits)) continue;
+        w->cand[i] &= (uint16_t)~bits;
+        changed = 1;
+    }
+    return changed;
+}
+
+// A box whose candidates for a digit all sit on one row or column clears that digit from the rest of the line
+static int pointing_pairs(HintWork *w) {
+    int n = w->n, b = w->b, changed = 0;
+    for (int box = 0; box < n; box++) {
+        for (int d = 1; d <= n; d++) {
+            uint16_t bit = (uint16_t)(1u << (d - 1));
+            int row = -1, col = -1, cells = 0;
+            for (int k = 0; k < n; k++) {
+                int i = unit_cell(n, b, UNIT_BOX, box, k);
+                if (!(w->cand[i] & bit)) continue;
+                int r = i / n, c = i % n;
+                row = (cells == 0 || row == r) ? r : -2;
+                col = (cells == 0 || col == c) ? c : -2;
+                cells++;
+            }
+            if (cells < 2) continue;
+            if (row >= 0) changed |= eliminate_line(w, UNIT_ROW, row, box, bit);
+            if (col >= 0) changed |= eliminate_line(w, UNIT_COL, col, box, bit);
+        }
+    }
+    return changed;
+}
+
+// Two cells of a unit with the same two candidates clear both digits from the rest of the unit
+static int naked_pairs(HintWork *w) {
+    int n = w->n, b = w->b, changed = 0;
+    for (int kind = 0; kind < 3; kind++) {
+        for (int unit = 0; unit < n; unit++) {
+            for (int k = 0; k < n; k++) {
+                uint16_t pair = w->cand[unit_cell(n, b, kind, unit, k)];
+                if (popcount16(pair) != 2) continue;
+                for (int l = k + 1; l < n; l++) {
+                    if (w->cand[unit_cell(n, b, kind, unit, l)] != pair) continue;
+                    for (int m = 0; m < n; m++) {
+                        int i = unit_cell(n, b, kind, unit, m);
+                        if (m == k || m == l || !(w->cand[i] & pair)) continue;
+                        w->cand[i] &= (uint16_t)~pair;
+                        changed = 1;
+                    }
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+int sudoku_hint_find(const SudokuGame *game, SudokuHint *hint) {
+    hint->technique = TECH_NONE;
+    hint->row = game->selected_row;
+    hint->col = game->selected_col;
+    hint->digit = 0;
+    if (find_conflict(game, hint)) return 1;
+
+    HintWork w;
+    work_init(&w, game);
+
+    // Singles first, the eliminations only run while there is none, the hint keeps the hardest step
+    SudokuTechnique needed = TECH_NONE;
+    for (;;) {
+        if (naked_single(&w, hint) || hidden_single(&w, game, hint)) {
+            if (needed > hint->technique) hint->technique = needed;
+            return 1;
+        }
+        if (pointing_pairs(&w)) {
+            if (needed < TECH_POINTING_PAIR) needed = TECH_POINTING_PAIR;
+        } else if (naked_pairs(&w)) {
+            needed = TECH_NAKED_PAIR;
+        } else {
+            break;
+        }
+    }
+    hint->technique = TECH_NONE;
+    hint->digit = 0;
+    return 0;
+}
+
+const char *sudoku_technique_name(SudokuTechnique technique) {
+    return technique_names[technique];
+}
+
+void sudoku_hint_text(const SudokuHint *hint, char text[HINT_TEXT_MAX + 1]) {
+    int n = 0;
+    for (const char *s = technique_names[hint->technique]; *s && n < HINT_TEXT_MAX - 2; s++) text[n++] = *s;
+    if (hint->digit) {
+        text[n++] = ' ';
+        text[n++] = hint->digit <= 9 ? (char)('0' + hint->digit) : (char)('A' + hint->digit - 10);   // A-G like the board
+    }
+    text[n] = '\0';
+}
@@ -0,0 +1,39 @@
+// Zunjee, Sudoku hints: the next move that logic forces, found from candidates kept up to date
+// by sudoku_update, and the hardest technique a puzzle needs for the host grader
+#ifndef SUDOKU_HINT_H
+#define SUDOKU_HINT_H
+
+#include "sudoku.h"
+
+// Techniques from easiest to hardest, a hint is graded by the hardest one it needed
+typedef enum {
+    TECH_NONE,              // Nothing found, the grid needs more than these or has a wrong entry
+    TECH_NAKED_SINGLE,      // The cell has one candidate left
+    TECH_HIDDEN_SINGLE,     // The digit fits one cell of a row, column or box
+    TECH_POINTING_PAIR,     // Singles appear once a box's candidates for a digit clear their line
+    TECH_NAKED_PAIR,        // Singles appear once two cells sharing two candidates clear their unit
+    TECH_CONFLICT,          // The same digit twice in a unit, the cell is one of them
+    TECH_COUNT
+} SudokuTechnique;
+
+typedef struct {
+    SudokuTechnique technique;
+    int row, col;
+    int digit;              // Forced digit, 0 for TECH_CONFLICT and TECH_NONE
+} SudokuHint;
+
+// Recount every unit, sudoku_init does this, call it after changing cells by other means
+void sudoku_hint_reset(SudokuGame *game);
+
+// Cell (row, col) changed from old_value to its current value, called by sudoku_update
+void sudoku_hint_note(SudokuGame *game, int row, int col, int old_value);
+
+// Next forced move on the current grid, returns 0 (technique TECH_NONE) when there is none
+int sudoku_hint_find(const SudokuGame *game, SudokuHint *hint);
+
+// Status bar text, "NAKED SINGLE 5", at most HINT_TEXT_MAX characters
+#define HINT_TEXT_MAX 16
+void sudoku_hint_text(const SudokuHint *hint, char text[HINT_TEXT_MAX + 1]);
+const char *sudoku_technique_name(SudokuTechnique technique);
+
+#endif
@@ -1,40 +1,48 @@
 // Zunjee, reading input from DTEKV switches and keys
 #include "sudoku_input_vga.h"
 #include "dtekv_board.h"
+#include "latency.h"
+#include "key_repeat.h"
+#include "mmio.h"
 
-// Switch and Key Memory Addresses
-volatile int *SWITCHES = (volatile int *) SWITCH_base;
-volatile int *keys1    = (volatile int *) KEY1_base; 
-
-// Debounce state variables, only reacts to new KEY1/SWITCHES presses
+// Debounce state variables, only reacts to new KEY1/SWITCHES presses and to KEY1 repeats
 static int prev_switches = 0;  
-static int prev_keys     = 0;   
+static KeyRepeat key1 = { 1, 0, KEY_REPEAT_FIRST_MS };   // Taken as held until it is seen released
+
+#define DIRECTION_SWITCHES ((1 << SW_up) | (1 << SW_down) | (1 << SW_right) | (1 << SW_left))
+
+void reset_input_vga(void) {
+    key_repeat_init(&key1, key1_down(mmio_keys()));
+}
 
 InputAction get_input_vga(void) {
-    int current_switches = *SWITCHES;
-    int current_keys     = *keys1;
+    int current_switches = (int)mmio_switches();
+    int current_keys     = (int)mmio_keys();
 
     InputAction action = INPUT_NONE;
 
-    // Key is pressed when the bit is 0, released when 1
-    int key_was_pressed = !(prev_keys & (1 << KEY_enter));
-    int key_is_pressed  = !(current_keys & (1 << KEY_enter));
-
-    // Detect rising edge of PRESS (released -> pressed)
-    int key1_pressed = (!key_was_pressed && key_is_pressed);
+    // Press edge (released -> pressed), or KEY1 held on a direction long enough to repeat
+    int direction = (current_switches & DIRECTION_SWITCHES) != 0;
+    KeyEvent event = key_repeat_poll(&key1, key1_down((uint32_t)current_keys), direction);
 
-    if (key1_pressed) {
+    if (event != KEY_EVENT_NONE) {
         if      (current_switches & (1 << SW_up))         action = INPUT_UP;        // Switch 4
         else if (current_switches & (1 << SW_down))       action = INPUT_DOWN;      // Switch 5
         else if (current_switches & (1 << SW_right))      action = INPUT_RIGHT;     // Switch 6
         else if (current_switches & (1 << SW_left))       action = INPUT_LEFT;      // Switch 7
+        else if ((current_switches & (1 << SW_ACTION_1)) &&
+                 (current_switches & (1 << SW_ACTION_2))) action = INPUT_NOTES;     // Switch 8 + 9
         else if (current_switches & (1 << SW_ACTION_1))   action = INPUT_ERASE;     // Switch 8
         else if (current_switches & (1 << SW_ACTION_2))   action = INPUT_INCREMENT; // Switch 9
         else                                              action = INPUT_ENTER;    // Default: plain enter
+
+        if (action == INPUT_INCREMENT)  LAT_INPUT(LAT_DIGIT);
+        else if (action == INPUT_ERASE) LAT_INPUT(LAT_ERASE);
+        else if (action == INPUT_ENTER || action == INPUT_NOTES) LAT_INPUT(LAT_DIGIT);
+        else LAT_INPUT(LAT_MOVE);
     }
 
     prev_switches = current_switches;
-    prev_keys     = current_keys;
 
     return action;
 }
@@ -5,5 +5,7 @@
 
 // Function that reads  DTEKV switches and keys and returns the corresponding InputAction
 InputAction get_input_vga(void);
+// Start of a game: KEY1 still down from the press that started it does not count
+void reset_input_vga(void);
 
 #endif
\ No newline at end of file
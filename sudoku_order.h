@@ -0,0 +1,214 @@
+// Zunjee, sudoku game logic for one grid order, included once per size by sudoku.c
+// The includer defines SUDOKU_B (box side) and SUDOKU_N (SUDOKU_B * SUDOKU_B, as a literal)
+// No include guard on purpose, every inclusion generates a new set of functions
+
+#if !defined(SUDOKU_B) || !defined(SUDOKU_N) || SUDOKU_N != SUDOKU_B * SUDOKU_B
+#error "define SUDOKU_B and SUDOKU_N before including sudoku_order.h"
+#endif
+
+#define SDK(name) SUDOKU_SPECIALIZE(name)
+
+// One bit per value, 4, 9 or 16 bits wide
+#if SUDOKU_N <= 8
+#define SDK_MASK uint8_t
+#else
+#define SDK_MASK uint16_t
+#endif
+#define SDK_FULL ((SDK_MASK)((1u << SUDOKU_N) - 1u))
+
+// Cells removed for easy, medium and hard, roughly the same share of the grid for every size
+#if SUDOKU_N == 4
+#define SDK_REMOVE_EASY 6
+#define SDK_REMOVE_MEDIUM 8
+#define SDK_REMOVE_HARD 10
+#elif SUDOKU_N == 9
+#define SDK_REMOVE_EASY 35
+#define SDK_REMOVE_MEDIUM 45
+#define SDK_REMOVE_HARD 55
+#else
+#define SDK_REMOVE_EASY 110
+#define SDK_REMOVE_MEDIUM 140
+#define SDK_REMOVE_HARD 170
+#endif
+
+// Symmetry transform: an element of the Sudoku symmetry group (band and stack order, row order
+// inside each band, column order inside each stack, transpose, digit names) flattened into
+// a gather table, cell i of the result is digit[value of cell src[i]]
+typedef struct {
+    uint8_t src[SUDOKU_N * SUDOKU_N];
+    uint8_t digit[SUDOKU_N + 1];        // digit[0] = 0, empty cells stay empty
+} SDK(Transform);
+
+// Unbiased Fisher-Yates shuffle of a[0..n-1]
+static void SDK(shuffle)(uint8_t *a, int n) {
+    for (int i = n - 1; i > 0; i--) {
+        int j = (int)(sdk_rand() % (uint32_t)(i + 1));
+        uint8_t tmp = a[i];
+        a[i] = a[j];
+        a[j] = tmp;
+    }
+}
+
+// Source line of every line: bands (or stacks) in random order, lines inside each in random order
+static void SDK(random_lines)(uint8_t line[SUDOKU_N]) {
+    uint8_t group[SUDOKU_B], inner[SUDOKU_B];
+    for (int g = 0; g < SUDOKU_B; g++) group[g] = (uint8_t)g;
+    SDK(shuffle)(group, SUDOKU_B);
+    for (int g = 0; g < SUDOKU_B; g++) {
+        for (int i = 0; i < SUDOKU_B; i++) inner[i] = (uint8_t)i;
+        SDK(shuffle)(inner, SUDOKU_B);
+        for (int i = 0; i < SUDOKU_B; i++) line[g * SUDOKU_B + i] = (uint8_t)(group[g] * SUDOKU_B + inner[i]);
+    }
+}
+
+static void SDK(random_transform)(SDK(Transform) *t) {
+    uint8_t row_src[SUDOKU_N], col_src[SUDOKU_N];
+    SDK(random_lines)(row_src);
+    SDK(random_lines)(col_src);
+    int transpose = (int)(sdk_rand() & 1);
+
+    for (int i = 0; i <= SUDOKU_N; i++) t->digit[i] = (uint8_t)i;
+    SDK(shuffle)(&t->digit[1], SUDOKU_N);
+
+    for (int r = 0; r < SUDOKU_N; r++)
+        for (int c = 0; c < SUDOKU_N; c++)
+            t->src[r * SUDOKU_N + c] = transpose ? (uint8_t)(row_src[c] * SUDOKU_N + col_src[r])
+                                                 : (uint8_t)(row_src[r] * SUDOKU_N + col_src[c]);
+}
+
+// Value of cell i of the solved starting grid, the 9x9 one comes from sudoku_puzzles.c,
+// other sizes use the shifted-row pattern
+static inline int SDK(base_value)(int i) {
+    int r = i / SUDOKU_N, c = i % SUDOKU_N;
+#if SUDOKU_N == 9
+    return solved_grid[r][c];
+#else
+    return ((r % SUDOKU_B) * SUDOKU_B + r / SUDOKU_B + c) % SUDOKU_N + 1;
+#endif
+}
+
+// Cells emptied for the difficulty, picked in the transformed grid
+static void SDK(pick_holes)(uint8_t hole[SUDOKU_N * SUDOKU_N], int cells_to_remove) {
+    for (int i = 0; i < SUDOKU_N * SUDOKU_N; i++) hole[i] = 0;
+    int removed = 0;
+    while (removed < cells_to_remove) {
+        int i = (int)(sdk_rand() % (SUDOKU_N * SUDOKU_N));
+        if (!hole[i]) {
+            hole[i] = 1;
+            removed++;
+        }
+    }
+}
+
+static void SDK(sudoku_init)(SudokuGame *game, SudokuDifficulty difficulty) {
+    memset(game, 0, sizeof(SudokuGame)); // Clear the game structure, set all values to 0
+    game->difficulty = difficulty; // Set the difficulty level
+    game->order = (SudokuOrder)SUDOKU_B;
+    game->size = SUDOKU_N;
+    game->state = GAME_RUNNING; // Set initial game state to running
+    game->selected_row = 0;     // Start with the first cell selected, top-left corner
+    game->selected_col = 0;
+    game->note_digit = 1;
+
+    int cells_to_remove;    // Determine number of cells to remove based on difficulty
+    if (difficulty == EASY) {
+        cells_to_remove = SDK_REMOVE_EASY;
+    } else if (difficulty == MEDIUM) {
+        cells_to_remove = SDK_REMOVE_MEDIUM;
+    } else {
+        cells_to_remove = SDK_REMOVE_HARD;
+    }
+
+    uint32_t mark = arena_mark(&frame_arena);
+    SDK(Transform) *t = arena_alloc(&frame_arena, sizeof(SDK(Transform)));
+    uint8_t *hole = arena_alloc(&frame_arena, SUDOKU_N * SUDOKU_N);
+    SDK(random_transform)(t);
+    SDK(pick_holes)(hole, cells_to_remove);
+
+    // One gather pass writes the solution and the puzzle
+    for (int r = 0; r < SUDOKU_N; r++) {
+        for (int c = 0; c < SUDOKU_N; c++) {
+            int i = r * SUDOKU_N + c;
+            int value = t->digit[SDK(base_value)(t->src[i])];
+            game->solution[r][c] = value;
+            game->grid.cells[r][c].value = hole[i] ? 0 : value;
+            game->grid.cells[r][c].fixed = !hole[i];   // Given cells can not be changed
+        }
+    }
+    arena_release(&frame_arena, mark);
+    sudoku_hint_reset(game);
+}
+
+// Move a generated game to another grid of its class picked by the generator, a puzzle made ahead of time still
+// differs from game to game. Gathers from a copy of the grid, the game has no moves yet.
+static void SDK(sudoku_transform)(SudokuGame *game) {
+    uint32_t mark = arena_mark(&frame_arena);
+    SDK(Transform) *t = arena_alloc(&frame_arena, sizeof(SDK(Transform)));
+    uint8_t *solution = arena_alloc(&frame_arena, SUDOKU_N * SUDOKU_N);
+    uint8_t *given = arena_alloc(&frame_arena, SUDOKU_N * SUDOKU_N);   // Solution digit, 0 where empty
+    SDK(random_transform)(t);
+
+    for (int r = 0; r < SUDOKU_N; r++) {
+        for (int c = 0; c < SUDOKU_N; c++) {
+            solution[r * SUDOKU_N + c] = (uint8_t)game->solution[r][c];
+            given[r * SUDOKU_N + c] = (uint8_t)(game->grid.cells[r][c].fixed ? game->solution[r][c] : 0);
+        }
+    }
+
+    for (int r = 0; r < SUDOKU_N; r++) {
+        for (int c = 0; c < SUDOKU_N; c++) {
+            int i = t->src[r * SUDOKU_N + c];
+            int value = t->digit[given[i]];
+            game->solution[r][c] = t->digit[solution[i]];
+            game->grid.cells[r][c].value = value;
+            game->grid.cells[r][c].fixed = value != 0;
+        }
+    }
+    arena_release(&frame_arena, mark);
+    sudoku_hint_reset(game);
+}
+
+static int SDK(sudoku_is_full)(const SudokuGame *game) {
+    for (int row = 0; row < SUDOKU_N; ++row)
+        for (int col = 0; col < SUDOKU_N; ++col)
+            if (game->grid.cells[row][col].value == 0)
+                return 0;
+    return 1;
+}
+
+// Returns 1 if won, sets GAME_LOST on a full board with a repeated value, 0 otherwise
+static int SDK(sudoku_check_win)(SudokuGame *game) {
+    // If board is not full, just keep playing
+    if (!SDK(sudoku_is_full)(game)) {
+        return 0;
+    }
+
+    // Board is full → row i, column i and box i must each hold every value once
+    for (int i = 0; i < SUDOKU_N; i++) {
+        SDK_MASK row_seen = 0, col_seen = 0, box_seen = 0;
+        int box_r = (i / SUDOKU_B) * SUDOKU_B;
+        int box_c = (i % SUDOKU_B) * SUDOKU_B;
+        for (int j = 0; j < SUDOKU_N; j++) {
+            row_seen |= (SDK_MASK)(1u << (game->grid.cells[i][j].value - 1));
+            col_seen |= (SDK_MASK)(1u << (game->grid.cells[j][i].value - 1));
+            box_seen |= (SDK_MASK)(1u << (game->grid.cells[box_r + j / SUDOKU_B][box_c + j % SUDOKU_B].value - 1));
+        }
+        if (row_seen != SDK_FULL || col_seen != SDK_FULL || box_seen != SDK_FULL) {
+            game->state = GAME_LOST;
+            return 0;
+        }
+    }
+
+    // If we reach here, board is full and valid
+    game->state = GAME_WON;
+    return 1;
+}
+
+#undef SDK
+#undef SDK_MASK
+#undef SDK_FULL
+#undef SDK_REMOVE_EASY
+#undef SDK_REMOVE_MEDIUM
+#undef SDK_REMOVE_HARD
+#undef SUDOKU_B
+#undef SUDOKU_N
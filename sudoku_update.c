@@ -1,6 +1,7 @@
 // Zunjee, updates the game state based on input actions
 #include "sudoku.h"
 #include "dtekv_board.h"
+#include "sudoku_hint.h"
 
 // Updates the game state based on input action, called from main loop
 void sudoku_update(SudokuGame *game, InputAction action) {
@@ -8,33 +9,49 @@ void sudoku_update(SudokuGame *game, InputAction action) {
 
     int row = game->selected_row;
     int col = game->selected_col;
+    int old_value = game->grid.cells[row][col].value;
 
     switch (action) {
         case INPUT_UP:
             if (row > 0) game->selected_row--;
             break;
         case INPUT_DOWN:
-            if (row < SUDOKU_SIZE - 1) game->selected_row++;
+            if (row < game->size - 1) game->selected_row++;
             break;
         case INPUT_LEFT:
             if (col > 0) game->selected_col--;
             break;
         case INPUT_RIGHT:
-            if (col < SUDOKU_SIZE - 1) game->selected_col++;
+            if (col < game->size - 1) game->selected_col++;
             break;
         case INPUT_INCREMENT:
-            if (!game->grid.cells[row][col].fixed) {
+            if (game->notes_mode) {
+                game->note_digit = (game->note_digit % game->size) + 1; // Cycle the candidate 1-size
+            } else if (!game->grid.cells[row][col].fixed) {
                 int value = game->grid.cells[row][col].value;
-                value = (value % 9) + 1; // Cycle 1-9
+                value = (value % game->size) + 1; // Cycle 1-size
                 game->grid.cells[row][col].value = value;
             }
             break;
         case INPUT_ERASE:
             if (!game->grid.cells[row][col].fixed) {
                 game->grid.cells[row][col].value = 0;
+                if (game->notes_mode) game->grid.cells[row][col].notes = 0;
+            }
+            break;
+        case INPUT_ENTER:
+            // Notes sit under an entered digit and show again when it is erased
+            if (game->notes_mode && !game->grid.cells[row][col].fixed) {
+                game->grid.cells[row][col].notes ^= (uint16_t)(1u << (game->note_digit - 1));
             }
             break;
+        case INPUT_NOTES:
+            if (game->size <= SUDOKU_NOTES_MAX_SIZE) game->notes_mode = !game->notes_mode;
+            break;
         default:
             break;
     }
+
+    // Keep the hint engine's unit counts in step, one cell at a time
+    if (game->grid.cells[row][col].value != old_value) sudoku_hint_note(game, row, col, old_value);
 }
@@ -3,28 +3,27 @@
 #include "dtekv_board.h" 
 #include "sudoku_vga.h"
 #include "sudoku.h"
-
-// VGA screen dimensions
-#define VGA_WIDTH 320
-#define VGA_HEIGHT 240
-
-
-// Grid layout constants
-#define CELL_SIZE 24      // Each cell is 24x24 pixels
-#define GRID_ORIGIN_X 52  // Top-left corner of the grid
-#define GRID_ORIGIN_Y 12   // Top-left corner of the grid
-#define BOARD_SIZE (CELL_SIZE * SUDOKU_SIZE) // 216 pixels for 9 cells
+#include "profile.h"
+#include "display_list.h"
+#include "latency.h"
+#include "hud.h"
+#include "assets.h"
+#include "sprite.h"
+#include "art.h"
+#include "mmio.h"
+#include "transition.h"
+
+// Grid layout constants, cell size and origin per grid size are in sudoku_vga_order.h
+#define GRID_MARGIN 12    // Space kept above and below the board
 #define LINE_THICKNESS 2 // Thickness of grid lines
-
-
-// VGA Memory Addresses
-volatile char *VGA = (volatile char *) VGA_Buffer;
-volatile int *VGA_ctrl = (volatile int*) VGA_DMA;
+#define STATUS_BAR_Y (SCREEN_H - GRID_MARGIN + LINE_THICKNESS)  // Status bar in the bottom margin
+#define BANNER_Y ((SCREEN_H - 2 * HUD_BANNER_H) / 2)
+#define ART_Y (BANNER_Y - 44)     // End of game art above the banners
 
 // Draw a single pixel at (x, y) with the specified color
 void draw_pixel(int x, int y, char color) {
-    if (x >= 0 && x < VGA_WIDTH && y >= 0 && y < VGA_HEIGHT) {
-        VGA[y * VGA_WIDTH + x] = color;
+    if (x >= 0 && x < SCREEN_W && y >= 0 && y < SCREEN_H) {
+        fb_write(y * SCREEN_W + x, (uint8_t)color);
     }
 }
 
@@ -52,170 +51,170 @@ char get_box_color(int box_row, int box_col) {
     return box_colors[box_row][box_col];
 }
 
-// 5x5 bitmap for digits 0–9
-static const unsigned char digits_compact[10][5] = {
-    {0x1F, 0x11, 0x11, 0x11, 0x1F}, // 0
-    {0x04, 0x06, 0x04, 0x04, 0x1F}, // 1
-    {0x1F, 0x10, 0x1F, 0x01, 0x1F}, // 2
-    {0x1F, 0x10, 0x1F, 0x10, 0x1F}, // 3
-    {0x11, 0x11, 0x1F, 0x10, 0x10}, // 4
-    {0x1F, 0x01, 0x1F, 0x10, 0x1F}, // 5
-    {0x1F, 0x01, 0x1F, 0x11, 0x1F}, // 6
-    {0x1F, 0x10, 0x08, 0x04, 0x02}, // 7
-    {0x1F, 0x11, 0x1F, 0x11, 0x1F}, // 8
-    {0x1F, 0x11, 0x1F, 0x10, 0x1F}  // 9 
-};
-
-// Helper function to draw a digit centered in a cell
-void draw_digit(int grid_x, int grid_y, int number, char color) {
-    if(number < 1 || number > 9) return; // Sudoku uses 1–9
-
-    int cell_size = CELL_SIZE;
-    int pixel_x = GRID_ORIGIN_X + grid_x * cell_size;
-    int pixel_y = GRID_ORIGIN_Y + grid_y * cell_size;
-
-    // Center the 5x5 digit in the cell
-    int margin = (cell_size - 5*3) / 2; 
-    int start_x = pixel_x + margin;
-    int start_y = pixel_y + margin;
-
-    for (int row = 0; row < 5; row++) {
-        for (int col = 0; col < 5; col++) {
-            if ((digits_compact[number][row] >> (col)) & 1) {
-                for(int dx=0; dx<3; dx++)
-                    for(int dy=0; dy<3; dy++)
-                        draw_pixel(start_x + col*3 + dx, start_y + row*3 + dy, color);
-            }
-        }
-    }
-}
+// Selection frame, drawn over the flushed board
+static Sprite cursor;
 
-// Draw a single Sudoku cell at (cell_x, cell_y)
-void draw_sudoku_cell(int cell_x, int cell_y, const SudokuGame *game) {
-    int cell_size = CELL_SIZE;
-    int screen_x = GRID_ORIGIN_X + cell_x * cell_size;
-    int screen_y = GRID_ORIGIN_Y + cell_y * cell_size;
-
-    // Determine which 3x3 box this cell is in
-    int box_row = cell_y / 3;
-    int box_col = cell_x / 3;
-    char bg_color = get_box_color(box_row, box_col);
-
-    // Draw cell background
-    draw_block(screen_x, screen_y, cell_size, cell_size, bg_color);
-
-    // Draw cell border
-    for (int i = 0; i < cell_size; i++) {
-        draw_pixel(screen_x + i, screen_y, dark_gray); 
-        draw_pixel(screen_x, screen_y + i, dark_gray); 
-        draw_pixel(screen_x + i, screen_y + cell_size - 1, dark_gray); 
-        draw_pixel(screen_x + cell_size - 1, screen_y + i, dark_gray); 
-    }
+// Board drawing specialized for each grid size
+#define SUDOKU_B 2
+#define SUDOKU_N 4
+#include "sudoku_vga_order.h"
 
-    // Draw digit if present
-    int value = game->grid.cells[cell_y][cell_x].value; // Note: row = y, col = x
-    if (value != 0) {
-        char num_color = game->grid.cells[cell_y][cell_x].fixed ? black : blue; // Fixed numbers in black, user entries in blue
-        draw_digit(cell_x, cell_y, value, num_color);
-    }
-}
+#define SUDOKU_B 3
+#define SUDOKU_N 9
+#include "sudoku_vga_order.h"
 
-// Draw bold lines for 3x3 boxes
-void draw_bold_grid_lines(void) {
-    int cell_size = CELL_SIZE;
-    int thickness = LINE_THICKNESS;
+#define SUDOKU_B 4
+#define SUDOKU_N 16
+#include "sudoku_vga_order.h"
 
-    // Vertical bold lines
-    for (int i = 0; i <= SUDOKU_SIZE; i += 3) {
-        int x = GRID_ORIGIN_X + i * cell_size;
-        for (int t = 0; t < thickness; t++) {
-            draw_rect(x + t, GRID_ORIGIN_Y, thickness, BOARD_SIZE, black);
-        }
-    }
-
-    // Horizontal bold lines
-    for (int i = 0; i <= SUDOKU_SIZE; i += 3) {
-        int y = GRID_ORIGIN_Y + i * cell_size;
-        for (int t = 0; t < thickness; t++) {
-            draw_rect(GRID_ORIGIN_X, y + t, BOARD_SIZE, thickness, black);
-        }
+static void draw_cursor(const SudokuGame *game) {
+    switch (game->order) {
+        case SUDOKU_4X4:   draw_cursor_4(game); break;
+        case SUDOKU_16X16: draw_cursor_16(game); break;
+        default:           draw_cursor_9(game); break;
     }
 }
 
-// Draw the entire Sudoku board
-void draw_sudoku_board(const SudokuGame *game) {
-    // Draw background for the board area
-    draw_rect(GRID_ORIGIN_X - LINE_THICKNESS, GRID_ORIGIN_Y - LINE_THICKNESS, 
-              BOARD_SIZE + 2*LINE_THICKNESS, BOARD_SIZE + 2*LINE_THICKNESS, light_gray);
+// Left of the status bar when no hint is shown
+static char status[HUD_TEXT_MAX + 1];
+
+// Status bar under the board: difficulty and grid size on the left, empty cells on the right
+void sudoku_hud_begin(const SudokuGame *game) {
+    static const char *difficulty_names[3] = { "EASY ", "MEDIUM ", "HARD " };
+    static const char *size_names[5] = { "", "", "4X4", "9X9", "16X16" };
+    int n = 0;
+    for (const char *s = difficulty_names[game->difficulty]; *s; s++) status[n++] = *s;
+    for (const char *s = size_names[game->order]; *s; s++) status[n++] = *s;
+    status[n] = '\0';
+
+    hud_reset();
+    hud_bar(STATUS_BAR_Y, SCREEN_H - STATUS_BAR_Y, white);
+    hud_place(HUD_STATUS, 4, 15 * 8 + 2 * HUD_BAR_PAD, dark_gray);    // Room for "POINTING PAIR 5"
+    hud_place(HUD_COUNT_B, 136, 7 * 8 + 2 * HUD_BAR_PAD, blue);
+    hud_place(HUD_COUNT_A, 228, 11 * 8 + 2 * HUD_BAR_PAD, dark_gray);
+    hud_set_text(HUD_STATUS, status);
+}
 
-    // Draw each cell
-    for (int row = 0; row < SUDOKU_SIZE; row++) {
-        for (int col = 0; col < SUDOKU_SIZE; col++) {
-            draw_sudoku_cell(col, row, game);
-        }
-    }
+// Hint text in place of the difficulty, NULL puts the difficulty back
+void sudoku_hud_hint(const char *text) {
+    hud_set_text(HUD_STATUS, text ? text : status);
+}
 
-    // Draw bold grid lines on top
-    draw_bold_grid_lines();
+static int count_empty(const SudokuGame *game) {
+    int empty = 0;
+    for (int r = 0; r < game->size; r++)
+        for (int c = 0; c < game->size; c++)
+            if (game->grid.cells[r][c].value == 0) empty++;
+    return empty;
 }
 
-// Draw cursor around currently selected cell
-void draw_cursor(const SudokuGame *game) {
-    int cell_size = CELL_SIZE;
-    int screen_x = GRID_ORIGIN_X + game->selected_col * cell_size;
-    int screen_y = GRID_ORIGIN_Y + game->selected_row * cell_size;
-
-    // Draw yellow border around selected cell
-    for (int i = 0; i < cell_size; i++) {
-        draw_pixel(screen_x + i, screen_y, yellow);
-        draw_pixel(screen_x + i, screen_y + cell_size - 1, yellow);
-        draw_pixel(screen_x, screen_y + i, yellow);
-        draw_pixel(screen_x + cell_size - 1, screen_y + i, yellow);
-    }
+// Status bar contents: empty cells, and the candidate KEY1 toggles while in notes mode
+static void update_status(const SudokuGame *game) {
+    hud_set_number(HUD_COUNT_A, "EMPTY", count_empty(game));
+    if (game->notes_mode) hud_set_number(HUD_COUNT_B, "NOTE", game->note_digit);
+    else hud_hide(HUD_COUNT_B);
 }
 
-// main render function to be called from main loop, draws the entire game state
+// main render function to be called from main loop, emits the entire game state to the display list
 void sudoku_render_vga(const SudokuGame *game) {
-    // Clear screen
-    draw_rect(0, 0, VGA_WIDTH, VGA_HEIGHT, white);
-
-    // Draw the Sudoku board
-    draw_sudoku_board(game);
-
-    // Draw the cursor if game is running
-    if (game->state == GAME_RUNNING) {
-        draw_cursor(game);
+    PROF_BEGIN(PROF_SUDOKU_RENDER);
+
+    // Banners come off before the board is drawn over them
+    hud_lift();
+
+    // Clear screen, the status bar keeps its pixels
+    dl_rect(0, 0, SCREEN_W, STATUS_BAR_Y, white);
+
+    // Draw the Sudoku board, the cursor goes on top once it is written
+    sprite_forget(&cursor);
+    switch (game->order) {
+        case SUDOKU_4X4:
+            draw_sudoku_board_4(game);
+            break;
+        case SUDOKU_16X16:
+            draw_sudoku_board_16(game);
+            break;
+        default:
+            draw_sudoku_board_9(game);
+            break;
     }
 
-    // Game end text
-    if (game->state == GAME_WON) {
-       int msg_x = 128;
-       int msg_y = 120;
-       draw_text(msg_x, msg_y, "YOU WON!", green);
-    } else if (game->state == GAME_LOST) {
-       int msg_x = 124;
-       int msg_y = 120;
-       draw_text(msg_x, msg_y, "GAME OVER", red);
-    }
+    // Write the frame in one sweep
+    dl_flush();
+    if (game->state == GAME_RUNNING) draw_cursor(game);
+    if (game->state == GAME_WON) rle_draw(&art_trophy, (SCREEN_W - art_trophy.w) / 2, ART_Y);
+    if (game->state == GAME_LOST) rle_draw(&art_mine_burst, (SCREEN_W - art_mine_burst.w) / 2, ART_Y);
+
+    // The bottom bold line of the 4x4 and 9x9 boards reaches one row into the status bar
+    hud_damage(0, STATUS_BAR_Y, SCREEN_W, 1);
 
-    // Draw end game screens 
+    // End game banners and the status bar go on top, only what changed is drawn
     if (game->state == GAME_WON || game->state == GAME_LOST) {
         draw_game_over(game);
     }
+    update_status(game);
+    hud_draw();
+
+    PROF_END(PROF_SUDOKU_RENDER);
 
     // Trigger VGA DMA to update the screen
-    *VGA_ctrl = 1; 
+    vga_present();
 }
 
+// Cursor move with nothing else changed: two frame perimeters copied, fast enough for KEY1 repeats
+void sudoku_render_cursor_vga(const SudokuGame *game) {
+    PROF_BEGIN(PROF_SUDOKU_RENDER);
+
+    draw_cursor(game);
+    hud_draw();     // A hint moves the cursor and names the technique
+
+    PROF_END(PROF_SUDOKU_RENDER);
+
+    vga_present();
+}
+
+// Pencil mark edit in the selected cell: the mini digits that changed and the status bar,
+// about the cost of a cursor move
+void sudoku_render_notes_vga(const SudokuGame *game, uint16_t old_notes) {
+    PROF_BEGIN(PROF_SUDOKU_RENDER);
+
+    switch (game->order) {
+        case SUDOKU_4X4:
+            draw_notes_diff_4(game, old_notes);
+            break;
+        case SUDOKU_16X16:
+            break;      // No notes on 16x16
+        default:
+            draw_notes_diff_9(game, old_notes);
+            break;
+    }
+    dl_flush();
+    update_status(game);
+    hud_draw();
+
+    PROF_END(PROF_SUDOKU_RENDER);
+
+    vga_present();
+}
+
+// Hand the finished frame to the VGA DMA, every game and the menu present through here
+void vga_present(void) {
+    if (transition_capture_end()) return;     // The next screen's first frame, the transition brings it in
+    PROF_BEGIN(PROF_PRESENT);
+    PROF_OVERLAY();     // Profiling overlay is drawn last so it sits on top of the frame
+    mmio_vga_kick();
+    MMIO_FRAME_END();   // Overlays included, they are part of what an instrumented frame costs
+    LAT_PRESENTED();    // Closes the latency of the KEY1 press that led to this frame
+    SIM_PRESENT();
+    PROF_END(PROF_PRESENT);
+}
+
+// End game banners, one HUD banner for the result and one for the way back
 void draw_game_over(const SudokuGame *game) {
     if (game->state == GAME_LOST) {
-        // Draw "GAME OVER" text
-        draw_text(120, 110, "GAME OVER", red);
+        hud_banner(HUD_BANNER, BANNER_Y, "GAME OVER", red, white);
     } else if (game->state == GAME_WON) {
-        // Draw "YOU WIN" text  
-        draw_text(130, 110, "YOU WIN", green);
+        hud_banner(HUD_BANNER, BANNER_Y, "YOU WON", green, white);
     }
-    
-    // Add "Press KEY1 to continue" message
-    draw_text(80, 130, "Press KEY1 to continue", black);
-}
\ No newline at end of file
+    hud_banner(HUD_BANNER_SUB, BANNER_Y + HUD_BANNER_H, "PRESS KEY1 TO CONTINUE", black, white);
+}
@@ -5,24 +5,21 @@
 #include "dtekv_board.h"
 
 void sudoku_render_vga(const SudokuGame *game);
+void sudoku_render_cursor_vga(const SudokuGame *game);    // Only the selection moved
+void sudoku_render_notes_vga(const SudokuGame *game, uint16_t old_notes);  // Notes of the selected cell or notes mode changed
+void sudoku_hud_begin(const SudokuGame *game);     // Status bar for a new game, before the first render
+void sudoku_hud_hint(const char *text);            // Hint in the status bar, NULL for the difficulty again
+void vga_present(void);     // Kick the VGA DMA with the finished frame
 
 // Pixel drawing 
 void draw_pixel(int x, int y, char color);
 void draw_rect(int x, int y, int width, int height, char color);
 void draw_block(int x, int y, int width, int height, char color);
 
-// Digit/cell drawing
-void draw_digit(int grid_x, int grid_y, int number, char color);
-void draw_sudoku_cell(int cell_x, int cell_y, const SudokuGame *game);
+// Digit, cell, board, bold line and cursor drawing are generated per grid size
+// from sudoku_vga_order.h inside sudoku_vga.c
 
-// Board and grid drawing
-void draw_sudoku_board(const SudokuGame *game);
-void draw_bold_grid_lines(void);    // Draw bold lines for 3x3 boxes
-
-// Cursor and highlights
-void draw_cursor(const SudokuGame *game);
-
-// End game screens 
+// End game screens, shown as HUD banners over the board
 void draw_game_over(const SudokuGame *game);
 void draw_text(int x, int y, const char *text, unsigned char color);
 
@@ -0,0 +1,152 @@
+// Zunjee, sudoku board drawing for one grid order, included once per size by sudoku_vga.c
+// The includer defines SUDOKU_B (box side) and SUDOKU_N (SUDOKU_B * SUDOKU_B, as a literal)
+// No include guard on purpose, every inclusion generates a new set of functions
+
+#if !defined(SUDOKU_B) || !defined(SUDOKU_N) || SUDOKU_N != SUDOKU_B * SUDOKU_B
+#error "define SUDOKU_B and SUDOKU_N before including sudoku_vga_order.h"
+#endif
+
+#define SDK(name) SUDOKU_SPECIALIZE(name)
+
+// Layout worked out at compile time: largest cell that fits the height, board centered on screen
+#define SDK_CELL ((SCREEN_H - 2 * GRID_MARGIN) / SUDOKU_N)    // 54, 24 or 13 pixels
+#define SDK_BOARD (SDK_CELL * SUDOKU_N)
+#define SDK_ORIGIN_X ((SCREEN_W - SDK_BOARD) / 2)
+#define SDK_ORIGIN_Y ((SCREEN_H - SDK_BOARD) / 2)
+#define SDK_SCALE ((SDK_CELL + 3) / 8)                          // Digit scale, 7, 3 or 2
+
+// Pencil marks: candidate d in slot d-1 of a SUDOKU_B x SUDOKU_B grid inside the cell,
+// inset past the frame and the bold lines that cover the top and left edge
+#define SDK_NOTE_INSET (LINE_THICKNESS + 1)
+#define SDK_NOTE_PITCH ((SDK_CELL - 2 * SDK_NOTE_INSET) / SUDOKU_B)    // 24, 6 or 1 pixels
+#define SDK_NOTE_SCALE (SDK_NOTE_PITCH >= 20 ? 3 : SDK_NOTE_PITCH / 6)  // 3, 1 or 0 (no notes)
+
+_Static_assert(SDK_BOARD + 2 * LINE_THICKNESS <= SCREEN_H, "sudoku board taller than the screen");
+_Static_assert(5 * SDK_SCALE + 2 <= SDK_CELL, "sudoku digit does not fit its cell");
+_Static_assert(SDK_CELL <= SPRITE_MAX_SIDE, "sudoku cursor larger than a sprite");
+_Static_assert(SUDOKU_N > SUDOKU_NOTES_MAX_SIZE || SDK_NOTE_SCALE > 0, "pencil marks do not fit the cell");
+
+// Helper function to draw a digit centered in a cell
+static void SDK(draw_digit)(int grid_x, int grid_y, int number, char color) {
+    if (number < 1 || number > SUDOKU_N) return;
+
+    int pixel_x = SDK_ORIGIN_X + grid_x * SDK_CELL;
+    int pixel_y = SDK_ORIGIN_Y + grid_y * SDK_CELL;
+
+    // Center the 5x5 digit in the cell
+    int margin = (SDK_CELL - 5 * SDK_SCALE) / 2;
+    dl_glyph(pixel_x + margin, pixel_y + margin, digits_compact[number], 5, 5, GLYPH_ROWS_LSB, SDK_SCALE, (uint8_t)color);
+}
+
+// Redraw one pencil mark slot: cleared to the cell background, then the mini digit if it is set
+static void SDK(draw_note)(int cell_x, int cell_y, int digit, int set, uint8_t bg_color) {
+#if SDK_NOTE_SCALE > 0
+    int slot = digit - 1;
+    int margin = (SDK_NOTE_PITCH - 5 * SDK_NOTE_SCALE) / 2;
+    int x = SDK_ORIGIN_X + cell_x * SDK_CELL + SDK_NOTE_INSET + (slot % SUDOKU_B) * SDK_NOTE_PITCH + margin;
+    int y = SDK_ORIGIN_Y + cell_y * SDK_CELL + SDK_NOTE_INSET + (slot / SUDOKU_B) * SDK_NOTE_PITCH + margin;
+    dl_rect(x, y, 5 * SDK_NOTE_SCALE, 5 * SDK_NOTE_SCALE, bg_color);
+    if (set) dl_glyph(x, y, digits_compact[digit], 5, 5, GLYPH_ROWS_LSB, SDK_NOTE_SCALE, dark_gray);
+#else
+    (void)cell_x; (void)cell_y; (void)digit; (void)set; (void)bg_color;
+#endif
+}
+
+// Draw a single Sudoku cell at (cell_x, cell_y)
+static void SDK(draw_sudoku_cell)(int cell_x, int cell_y, const SudokuGame *game) {
+    int screen_x = SDK_ORIGIN_X + cell_x * SDK_CELL;
+    int screen_y = SDK_ORIGIN_Y + cell_y * SDK_CELL;
+
+    // Box colors repeat every three boxes on the larger grid
+    char bg_color = get_box_color((cell_y / SUDOKU_B) % 3, (cell_x / SUDOKU_B) % 3);
+
+    // Draw cell background
+    dl_rect(screen_x, screen_y, SDK_CELL, SDK_CELL, (uint8_t)bg_color);
+
+    // Draw cell border
+    dl_frame(screen_x, screen_y, SDK_CELL, SDK_CELL, dark_gray);
+
+    // Draw digit if present
+    int value = game->grid.cells[cell_y][cell_x].value; // Note: row = y, col = x
+    if (value != 0) {
+        char num_color = game->grid.cells[cell_y][cell_x].fixed ? black : blue; // Fixed numbers in black, user entries in blue
+        SDK(draw_digit)(cell_x, cell_y, value, num_color);
+    } else {
+        // Pencil marks, only the set ones, the background is already clear
+        uint16_t notes = game->grid.cells[cell_y][cell_x].notes;
+        for (int d = 1; notes; d++, notes >>= 1)
+            if (notes & 1) SDK(draw_note)(cell_x, cell_y, d, 1, (uint8_t)bg_color);
+    }
+}
+
+// Draw bold lines between boxes
+static void SDK(draw_bold_grid_lines)(void) {
+    int thickness = LINE_THICKNESS;
+
+    // Vertical bold lines
+    for (int i = 0; i <= SUDOKU_N; i += SUDOKU_B) {
+        int x = SDK_ORIGIN_X + i * SDK_CELL;
+        for (int t = 0; t < thickness; t++) {
+            dl_rect(x + t, SDK_ORIGIN_Y, thickness, SDK_BOARD, black);
+        }
+    }
+
+    // Horizontal bold lines
+    for (int i = 0; i <= SUDOKU_N; i += SUDOKU_B) {
+        int y = SDK_ORIGIN_Y + i * SDK_CELL;
+        for (int t = 0; t < thickness; t++) {
+            dl_rect(SDK_ORIGIN_X, y + t, SDK_BOARD, thickness, black);
+        }
+    }
+}
+
+// Draw the entire Sudoku board
+static void SDK(draw_sudoku_board)(const SudokuGame *game) {
+    // Draw background for the board area
+    dl_rect(SDK_ORIGIN_X - LINE_THICKNESS, SDK_ORIGIN_Y - LINE_THICKNESS,
+            SDK_BOARD + 2 * LINE_THICKNESS, SDK_BOARD + 2 * LINE_THICKNESS, light_gray);
+
+    // Draw each cell
+    for (int row = 0; row < SUDOKU_N; row++) {
+        for (int col = 0; col < SUDOKU_N; col++) {
+            SDK(draw_sudoku_cell)(col, row, game);
+        }
+    }
+
+    // Draw bold grid lines on top
+    SDK(draw_bold_grid_lines)();
+}
+
+// Cursor around the selected cell, a save-under sprite: moving it puts back the old frame's pixels
+// and draws the new one, the cells are not drawn again. Called after the board is flushed
+static void SDK(draw_cursor)(const SudokuGame *game) {
+    int screen_x = SDK_ORIGIN_X + game->selected_col * SDK_CELL;
+    int screen_y = SDK_ORIGIN_Y + game->selected_row * SDK_CELL;
+    sprite_show(&cursor, screen_x, screen_y, SDK_CELL, SDK_CELL, yellow);
+}
+
+#if SUDOKU_N <= SUDOKU_NOTES_MAX_SIZE
+// Notes of the selected cell changed from old_notes: only the mini digits that differ are drawn.
+// Grids too large for notes never call it.
+static void SDK(draw_notes_diff)(const SudokuGame *game, uint16_t old_notes) {
+    int row = game->selected_row, col = game->selected_col;
+    const SudokuCell *cell = &game->grid.cells[row][col];
+    if (cell->value != 0) return;   // Hidden under the digit
+    uint8_t bg_color = (uint8_t)get_box_color((row / SUDOKU_B) % 3, (col / SUDOKU_B) % 3);
+    uint16_t changed = old_notes ^ cell->notes;
+    for (int d = 1; changed; d++, changed >>= 1)
+        if (changed & 1) SDK(draw_note)(col, row, d, (cell->notes >> (d - 1)) & 1, bg_color);
+}
+#endif
+
+#undef SDK
+#undef SDK_NOTE_INSET
+#undef SDK_NOTE_PITCH
+#undef SDK_NOTE_SCALE
+#undef SDK_CELL
+#undef SDK_BOARD
+#undef SDK_ORIGIN_X
+#undef SDK_ORIGIN_Y
+#undef SDK_SCALE
+#undef SUDOKU_B
+#undef SUDOKU_N
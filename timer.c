@@ -0,0 +1,45 @@
+// Zunjee, Karen, millisecond clock from the DTEK-V interval timer
+#include "timer.h"
+#include "dtekv_board.h"
+#include "mmio.h"
+
+// Interval timer registers, word index from TIMER_base
+#define TIMER_CONTROL 1
+#define TIMER_PERIODL 2
+#define TIMER_PERIODH 3
+#define TIMER_SNAPL 4
+#define TIMER_SNAPH 5
+
+#define CONTROL_CONT 0x2
+#define CONTROL_START 0x4
+#define CONTROL_STOP 0x8
+
+static uint32_t last_count;     // Counter value at the last poll, it counts down
+static uint32_t cycles;         // Cycles not yet turned into a whole millisecond
+static uint32_t ms;
+
+// Writing a snapshot register latches the running counter
+static uint32_t read_count(void) {
+    mmio_timer_write(TIMER_SNAPL, 0);
+    SIM_TIMER_SNAP();
+    return ((mmio_timer_read(TIMER_SNAPH) & 0xFFFF) << 16) | (mmio_timer_read(TIMER_SNAPL) & 0xFFFF);
+}
+
+void timer_start(void) {
+    mmio_timer_write(TIMER_CONTROL, CONTROL_STOP);
+    mmio_timer_write(TIMER_PERIODL, 0xFFFF);     // Period 2^32 cycles, so counter differences wrap cleanly
+    mmio_timer_write(TIMER_PERIODH, 0xFFFF);
+    mmio_timer_write(TIMER_CONTROL, CONTROL_CONT | CONTROL_START);
+    last_count = read_count();
+    cycles = 0;
+    ms = 0;
+}
+
+uint32_t timer_ms(void) {
+    uint32_t count = read_count();
+    cycles += last_count - count;       // Counting down, unsigned subtraction handles the wrap
+    last_count = count;
+    ms += cycles / TIMER_CYCLES_PER_MS;
+    cycles %= TIMER_CYCLES_PER_MS;
+    return ms;
+}
@@ -0,0 +1,13 @@
+// Zunjee, Karen, millisecond clock from the DTEK-V interval timer, independent of how fast the loops spin
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+
+#define TIMER_CLOCK_HZ 30000000     // The timer counts CPU clock cycles
+#define TIMER_CYCLES_PER_MS (TIMER_CLOCK_HZ / 1000)
+
+void timer_start(void);     // Free-running over the whole 32-bit period, call once at boot
+uint32_t timer_ms(void);    // Milliseconds since timer_start, must be polled at least every two minutes
+
+#endif
@@ -0,0 +1,68 @@
+// Zunjee, Karen, display list checks on the host: merges against the list limits, and the pixels
+// of every queued command still written in order
+//
+// Usage: dl_test, exits 1 after printing each failed check
+#include <stdio.h>
+#include <string.h>
+#include "dtekv_board.h"
+#include "display_list.h"
+
+volatile uint8_t sim_vga[SCREEN_W * SCREEN_H];
+
+#define FULL_BANDS DL_BANDS                         // Refs a full-height rect takes
+#define FILL_RECTS (DL_MAX_REFS / FULL_BANDS)       // Full-height rects that fit, one ref short of the limit
+#define TAIL_X (SCREEN_W - 1)
+
+_Static_assert(DL_MAX_REFS % FULL_BANDS == 1 && FILL_RECTS < TAIL_X && FILL_RECTS + 1 < DL_MAX_CMDS,
+               "the fill no longer ends one ref short of the limit");
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+    if (ok) return;
+    printf("dl_test: %s\n", what);
+    failures++;
+}
+
+// Column x is color from row y0 to y1 - 1
+static int column_is(int x, int y0, int y1, uint8_t color) {
+    for (int y = y0; y < y1; y++)
+        if (sim_vga[y * SCREEN_W + x] != color) return 0;
+    return 1;
+}
+
+// Two touching rects of one color on an empty list become one command
+static void merge_below_limit(void) {
+    memset((void *)sim_vga, 0, sizeof sim_vga);
+    dl_rect(10, 0, 4, DL_BAND_H, 5);
+    dl_rect(10, DL_BAND_H, 4, DL_BAND_H, 5);
+    dl_flush();
+    check(dl_last_stats()->merged == 1 && dl_last_stats()->commands == 1, "touching rects were not merged");
+    check(column_is(10, 0, 2 * DL_BAND_H, 5) && column_is(13, 0, 2 * DL_BAND_H, 5), "merged rect not drawn");
+}
+
+// The list filled to exactly DL_MAX_REFS, then a rect that would merge into the last one but needs
+// one more band: it has to be flushed and appended, a merge would overrun the band sort
+static void merge_at_limit(void) {
+    memset((void *)sim_vga, 0, sizeof sim_vga);
+    for (int x = 0; x < FILL_RECTS; x++) dl_rect(x, 0, 1, SCREEN_H, (uint8_t)(1 + x % 2));
+    dl_rect(TAIL_X, 0, 1, DL_BAND_H, 3);    // Refs now at the limit
+    dl_rect(TAIL_X, DL_BAND_H, 1, DL_BAND_H, 3);
+    dl_flush();
+    check(dl_last_stats()->merged == 0 && dl_last_stats()->commands == 1,
+          "rect merged past DL_MAX_REFS instead of starting a new list");
+
+    int filled = 1;
+    for (int x = 0; x < FILL_RECTS; x++) filled &= column_is(x, 0, SCREEN_H, (uint8_t)(1 + x % 2));
+    check(filled, "fill rects not drawn");
+    check(column_is(TAIL_X, 0, 2 * DL_BAND_H, 3) && column_is(TAIL_X, 2 * DL_BAND_H, SCREEN_H, 0),
+          "rects at the limit not drawn");
+}
+
+int main(void) {
+    merge_below_limit();
+    merge_at_limit();
+    if (failures) return 1;
+    printf("dl_test: ok\n");
+    return 0;
+}
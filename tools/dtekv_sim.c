@@ -0,0 +1,421 @@
+// Karen, Zunjee, host simulator: runs the whole game against memory-backed devices, driven by an input script
+//
+// Usage: dtekv_sim [-o latency.csv] [-m mmio.csv] [-g golden.crc [-u]] [-f frame_dir] [-r ref_dir] [script]
+//        (script from stdin if omitted)
+//
+// Script, one command per line, '#' starts a comment:
+//   sw <value>        set the switch register (decimal or 0x hex)
+//   on <n> / off <n>  set or clear switch n
+//   key [hold_ms]     press KEY1, hold it, release it and wait as long again, 20 ms by default
+//   wait <ms>         let the game run
+//   frames <n>        wait until n more frames have been presented (gives up after 5 s)
+//   snap              hash the framebuffer now, for screens that are drawn without a present
+//
+// The game runs on this thread against a simulated clock: every busy-wait loop in the game
+// (delay, busy_wait) advances it and runs the script up to the current time. The same script
+// therefore always gives the same frames, which is what the golden checks rely on. The
+// interval timer (timer.c) runs on the same clock, so KEY1 repeats land on the same frames too.
+//
+// Golden frames: every present (and snap) is hashed with CRC-32. -g compares the hashes with
+// a golden list, -g with -u writes the list instead. -f dumps every frame as PPM, -r points at
+// frames dumped from a known-good build; on a mismatch the frame and, with -r, a diff image
+// (unchanged pixels dimmed, changed pixels magenta) are written next to the dumps.
+//
+// Without -g the latency histograms of every action are written as CSV when the script ends.
+// Latency uses host time scaled to 30 MHz cycles, so compare builds on the same machine;
+// with -g the profiling clock is the simulated one so the overlay is reproducible too.
+//
+// -m writes the MMIO counts (mmio.h) of every presented frame as CSV: framebuffer bytes and
+// register accesses read and written per region. They do not depend on the clock.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../dtekv_board.h"
+#include "../latency.h"
+#include "../mmio.h"
+
+volatile uint32_t sim_io[0x200 / 4];
+volatile uint8_t sim_vga[SCREEN_W * SCREEN_H];
+static const volatile uint8_t *scanout = sim_vga;     // Frame the VGA DMA shows, see sim_vga_show
+
+#define IO_WORD(offset) sim_io[(offset) / 4]
+#define IO_SWITCHES 0x10
+#define IO_KEYS 0xd0
+#define IO_DMA 0x100
+#define IO_TIMER_SNAPL 0x30
+#define IO_TIMER_SNAPH 0x34
+
+#define FRAME_W SCREEN_W
+#define FRAME_H SCREEN_H
+#define FRAME_BYTES (FRAME_W * FRAME_H)
+
+#define SIM_CYCLES_PER_LOOP 3       // One busy-wait iteration on the DTEK-V, roughly
+#define SIM_CYCLES_PER_MS (LAT_CPU_HZ / 1000)
+#define FRAMES_TIMEOUT_MS 5000
+#define MAX_GOLDEN 4096
+#define MAX_DIFF_DUMPS 8
+
+int dtekv_main(void);       // main() of main.c, renamed by the Makefile
+
+// Simulated clock and the script position
+static uint64_t sim_cycles = 0;
+static FILE *script;
+static int script_line = 0;
+static uint64_t wake_at = 0;            // Script sleeps until this cycle
+static long frames_target = 0;          // or until this many frames, 0 = not waiting for frames
+static int key_release_pending = 0;
+static int key_hold_ms = 0;
+static int script_error = 0;
+
+// Options
+static int deterministic_clock = 0;
+static const char *csv_path = NULL;
+static FILE *mmio_csv = NULL;
+static const char *golden_path = NULL;
+static int golden_update = 0;
+static const char *frame_dir = NULL;
+static const char *ref_dir = NULL;
+
+// Frame hashes, expected ones loaded from the golden list
+static long frames = 0;
+static uint32_t expected[MAX_GOLDEN];
+static long expected_count = -1;
+static uint32_t seen[MAX_GOLDEN];
+static int seen_line[MAX_GOLDEN];
+static long mismatches = 0;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t sim_mcycle(void) {
+    if (deterministic_clock) return (uint32_t)sim_cycles;
+    return (uint32_t)(now_ns() * (LAT_CPU_HZ / 1000000) / 1000);
+}
+
+static uint32_t crc32(const volatile uint8_t *data, size_t len) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// RGB332 to 8-bit channels
+static void rgb332(uint8_t p, uint8_t out[3]) {
+    out[0] = (uint8_t)((p >> 5) * 255 / 7);
+    out[1] = (uint8_t)(((p >> 2) & 7) * 255 / 7);
+    out[2] = (uint8_t)((p & 3) * 255 / 3);
+}
+
+static int write_ppm(const char *path, const uint8_t *rgb) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", FRAME_W, FRAME_H);
+    fwrite(rgb, 3, FRAME_BYTES, f);
+    fclose(f);
+    return 1;
+}
+
+static void dump_frame(const char *dir, const char *prefix, long n) {
+    static uint8_t rgb[FRAME_BYTES * 3];
+    for (int i = 0; i < FRAME_BYTES; i++) rgb332(scanout[i], &rgb[i * 3]);
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s_%04ld.ppm", dir, prefix, n);
+    write_ppm(path, rgb);
+}
+
+// Reads back a frame written by dump_frame
+static int read_ppm(const char *path, uint8_t *rgb) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+    int w, h, max;
+    int ok = fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && w == FRAME_W && h == FRAME_H && fgetc(f) != EOF
+          && fread(rgb, 3, FRAME_BYTES, f) == FRAME_BYTES;
+    fclose(f);
+    return ok;
+}
+
+// Frame n does not match: keep it, and mark the changed pixels against the reference dump
+static void report_mismatch(long n) {
+    const char *dir = frame_dir ? frame_dir : ".";
+    if (!frame_dir) dump_frame(dir, "frame", n);
+    if (!ref_dir) return;
+
+    static uint8_t ref[FRAME_BYTES * 3], diff[FRAME_BYTES * 3];
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%04ld.ppm", ref_dir, n);
+    if (!read_ppm(path, ref)) {
+        fprintf(stderr, "  no reference frame %s\n", path);
+        return;
+    }
+
+    int changed = 0, x0 = FRAME_W, y0 = FRAME_H, x1 = -1, y1 = -1;
+    for (int i = 0; i < FRAME_BYTES; i++) {
+        uint8_t px[3];
+        rgb332(scanout[i], px);
+        uint8_t *d = &diff[i * 3];
+        if (memcmp(px, &ref[i * 3], 3) != 0) {
+            d[0] = 255; d[1] = 0; d[2] = 255;
+            int x = i % FRAME_W, y = i / FRAME_W;
+            if (x < x0) x0 = x;
+            if (y < y0) y0 = y;
+            if (x > x1) x1 = x;
+            if (y > y1) y1 = y;
+            changed++;
+        } else {
+            uint8_t grey = (uint8_t)((px[0] + px[1] + px[2]) / 9);
+            d[0] = d[1] = d[2] = grey;
+        }
+    }
+    snprintf(path, sizeof(path), "%s/diff_%04ld.ppm", dir, n);
+    if (write_ppm(path, diff))
+        fprintf(stderr, "  %d pixels differ in (%d,%d)-(%d,%d), see %s\n", changed, x0, y0, x1, y1, path);
+}
+
+static void record_frame(void) {
+    long n = frames++;
+    uint32_t crc = crc32(scanout, FRAME_BYTES);
+    if (n >= MAX_GOLDEN) {
+        fprintf(stderr, "more than %d frames, the rest are not checked\n", MAX_GOLDEN);
+        return;
+    }
+    seen[n] = crc;
+    seen_line[n] = script_line;
+
+    if (frame_dir) dump_frame(frame_dir, "frame", n);
+    if (expected_count >= 0 && !golden_update && n < expected_count && expected[n] != crc) {
+        fprintf(stderr, "frame %ld (script line %d): crc %08x, golden %08x\n", n, script_line, crc, expected[n]);
+        if (mismatches++ < MAX_DIFF_DUMPS) report_mismatch(n);
+    }
+}
+
+// Golden list: one "<frame> <crc>" line per frame, the script line after '#' is only for reading
+static void load_golden(const char *path) {
+    FILE *f = fopen(path, "r");
+    expected_count = 0;
+    if (!f) {
+        if (!golden_update) perror(path);
+        return;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        long n;
+        unsigned crc;
+        if (sscanf(line, "%ld %x", &n, &crc) == 2 && n == expected_count && n < MAX_GOLDEN)
+            expected[expected_count++] = crc;
+    }
+    fclose(f);
+}
+
+static int finish_golden(void) {
+    long count = frames < MAX_GOLDEN ? frames : MAX_GOLDEN;
+    if (golden_update) {
+        FILE *f = fopen(golden_path, "w");
+        if (!f) {
+            perror(golden_path);
+            return 1;
+        }
+        for (long n = 0; n < count; n++) fprintf(f, "%04ld %08x  # line %d\n", n, seen[n], seen_line[n]);
+        fclose(f);
+        printf("%s: %ld frames written\n", golden_path, count);
+        return 0;
+    }
+    if (count != expected_count) {
+        fprintf(stderr, "%ld frames presented, golden has %ld\n", count, expected_count);
+        return 1;
+    }
+    printf("%s: %ld frames, %ld mismatches\n", golden_path, count, mismatches);
+    return mismatches != 0;
+}
+
+// One row per action: count, min/avg/max in microseconds, then the bucket counts
+static void write_latency_csv(FILE *out) {
+    fprintf(out, "action,count,min_us,avg_us,max_us");
+    for (int b = 0; b < LAT_BUCKETS; b++) {
+        if (b == 0) fprintf(out, ",lt1ms");
+        else fprintf(out, ",ge%dms", 1 << (b - 1));
+    }
+    fprintf(out, "\n");
+
+    const uint32_t cycles_per_us = LAT_CPU_HZ / 1000000;
+    for (int a = 0; a < LAT_ACTION_COUNT; a++) {
+        const LatHist *h = lat_hist((LatAction)a);
+        fprintf(out, "%s,%u,%u,%u,%u", lat_label((LatAction)a), h->count,
+                h->count ? h->min_cycles / cycles_per_us : 0,
+                h->count ? h->sum_us / h->count : 0,
+                h->max_cycles / cycles_per_us);
+        for (int b = 0; b < LAT_BUCKETS; b++) fprintf(out, ",%u", h->buckets[b]);
+        fprintf(out, "\n");
+    }
+}
+
+// Header names each region's read and write columns, a row per present after it
+static void write_mmio_header(FILE *out) {
+    fprintf(out, "frame");
+    for (int r = 0; r < MMIO_REGION_COUNT; r++)
+        fprintf(out, ",%s_r,%s_w", mmio_label((MmioRegion)r), mmio_label((MmioRegion)r));
+    fprintf(out, "\n");
+}
+
+static void write_mmio_row(FILE *out) {
+    fprintf(out, "%ld", frames);
+    for (int r = 0; r < MMIO_REGION_COUNT; r++) {
+        const MmioCount *c = mmio_last((MmioRegion)r);
+        fprintf(out, ",%u,%u", c->reads, c->writes);
+    }
+    fprintf(out, "\n");
+}
+
+// Script is done: report and leave, the game itself never returns
+static void finish(void) {
+    int rc = script_error;
+    if (golden_path) {
+        rc |= finish_golden();
+    } else {
+        FILE *out = stdout;
+        if (csv_path && !(out = fopen(csv_path, "w"))) {
+            perror(csv_path);
+            exit(1);
+        }
+        write_latency_csv(out);
+        if (out != stdout) fclose(out);
+    }
+    fflush(NULL);
+    exit(rc);
+}
+
+// Run script commands until one has to wait for the clock or for frames
+static void run_script(void) {
+    for (;;) {
+        if (sim_cycles < wake_at) return;
+        if (frames_target) {
+            if (frames < frames_target) return;
+            frames_target = 0;
+        }
+        if (key_release_pending) {
+            IO_WORD(IO_KEYS) |= (1u << KEY_enter);
+            key_release_pending = 0;
+            wake_at = sim_cycles + (uint64_t)key_hold_ms * SIM_CYCLES_PER_MS;
+            continue;
+        }
+
+        char line[256];
+        if (!fgets(line, sizeof(line), script)) finish();
+        script_line++;
+        char *hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+
+        char cmd[32];
+        long arg = 0;
+        int n = sscanf(line, "%31s %li", cmd, &arg);
+        if (n < 1) continue;
+
+        if (strcmp(cmd, "sw") == 0 && n == 2) {
+            IO_WORD(IO_SWITCHES) = (uint32_t)arg;
+        } else if (strcmp(cmd, "on") == 0 && n == 2) {
+            IO_WORD(IO_SWITCHES) |= 1u << arg;
+        } else if (strcmp(cmd, "off") == 0 && n == 2) {
+            IO_WORD(IO_SWITCHES) &= ~(1u << arg);
+        } else if (strcmp(cmd, "key") == 0) {
+            // KEY1 rests high; the press pulls bit 0 low, which the menu and Sudoku treat as the press,
+            // the release brings it back high, which Minesweeper treats as the press
+            key_hold_ms = n == 2 ? (int)arg : 20;
+            IO_WORD(IO_KEYS) &= ~(1u << KEY_enter);
+            key_release_pending = 1;
+            wake_at = sim_cycles + (uint64_t)key_hold_ms * SIM_CYCLES_PER_MS;
+        } else if (strcmp(cmd, "wait") == 0 && n == 2) {
+            wake_at = sim_cycles + (uint64_t)arg * SIM_CYCLES_PER_MS;
+        } else if (strcmp(cmd, "frames") == 0 && n == 2) {
+            frames_target = frames + arg;
+            wake_at = sim_cycles;
+        } else if (strcmp(cmd, "snap") == 0) {
+            record_frame();
+        } else {
+            fprintf(stderr, "line %d: cannot parse '%s'\n", script_line, cmd);
+            script_error = 1;
+            finish();
+        }
+    }
+}
+
+void sim_idle(unsigned loops) {
+    sim_cycles += (uint64_t)loops * SIM_CYCLES_PER_LOOP;
+
+    // A frames command gives up once the game has been idle long enough
+    if (frames_target && sim_cycles >= wake_at + (uint64_t)FRAMES_TIMEOUT_MS * SIM_CYCLES_PER_MS) {
+        fprintf(stderr, "line %d: frames timed out\n", script_line);
+        frames_target = 0;
+    }
+    run_script();
+}
+
+// The interval timer counts down from 2^32 - 1 at the CPU clock, as timer.c sets it up
+void sim_timer_snap(void) {
+    uint32_t count = 0xFFFFFFFFu - (uint32_t)sim_cycles;
+    IO_WORD(IO_TIMER_SNAPL) = count & 0xFFFF;
+    IO_WORD(IO_TIMER_SNAPH) = count >> 16;
+}
+
+// The game pointed the DMA elsewhere, the hardware's 32-bit register cannot hold a host address
+void sim_vga_show(const volatile uint8_t *frame) {
+    scanout = frame;
+}
+
+// The game set the DMA register, take it back like the hardware would
+void sim_present(void) {
+    IO_WORD(IO_DMA) = 0;
+    if (mmio_csv) write_mmio_row(mmio_csv);
+    record_frame();
+}
+
+int main(int argc, char **argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "o:m:g:uf:r:")) != -1) {
+        switch (opt) {
+            case 'o': csv_path = optarg; break;
+            case 'm':
+                if (!(mmio_csv = fopen(optarg, "w"))) {
+                    perror(optarg);
+                    return 1;
+                }
+                write_mmio_header(mmio_csv);
+                break;
+            case 'g': golden_path = optarg; break;
+            case 'u': golden_update = 1; break;
+            case 'f': frame_dir = optarg; break;
+            case 'r': ref_dir = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-o latency.csv] [-m mmio.csv] [-g golden.crc [-u]] [-f frame_dir] [-r ref_dir] [script]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    script = stdin;
+    if (optind < argc && !(script = fopen(argv[optind], "r"))) {
+        perror(argv[optind]);
+        return 1;
+    }
+    if (golden_path) {
+        deterministic_clock = 1;
+        load_golden(golden_path);
+    }
+
+    IO_WORD(IO_KEYS) = 1u << KEY_enter;     // Released
+    run_script();       // Commands before the first wait apply from power-on
+    dtekv_main();
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Karen, headless Minesweeper batch runner: plays seeded bot games on every core and reports throughput
+//
+// Usage: ms_batch [-n games] [-l level]... [-t topology] [-s seed] [-j workers]
+//   -n  games per level (default 100000)
+//   -l  level 0-4 (EASY, MEDIUM, HARD, HUGE, GIANT), may be repeated, default 0-2
+//   -t  board shape 0-2 (SQUARE, TORUS, HEX), default 0
+//   -s  base seed (default 1), game i of a level always gets the same board
+//   -j  worker threads (default: online cores)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "ms_bot.h"
+
+static const char *level_names[MS_LEVEL_COUNT] = { "EASY", "MEDIUM", "HARD", "HUGE", "GIANT" };
+static const char *topology_names[MS_TOPO_COUNT] = { "SQUARE", "TORUS", "HEX" };
+
+// Totals for one level, summed over workers
+typedef struct {
+    long long games;
+    long long wins;
+    long long reveals;
+    long long flags;
+    long long guesses;
+    long long floods;
+    long long flood_cells;
+} LevelTotals;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// One worker thread, plays games index = id, id + workers, ... of every selected level on its own board
+typedef struct {
+    pthread_t thread;
+    int id, workers;
+    long long games;
+    const int *levels;
+    int nlevels;
+    MsTopology topology;
+    uint32_t seed;
+    int failed;
+    LevelTotals totals[MS_LEVEL_COUNT];
+} Worker;
+
+static void *run_worker(void *arg) {
+    Worker *w = arg;
+    MsBot *bot = ms_bot_new();
+    if (!bot) {
+        w->failed = 1;
+        return NULL;
+    }
+    for (int li = 0; li < w->nlevels; li++) {
+        MsLevel level = (MsLevel)w->levels[li];
+        LevelTotals *t = &w->totals[level];
+        for (long long i = w->id; i < w->games; i += w->workers) {
+            MsBotResult res;
+            ms_bot_play(bot, level, w->topology, ms_game_seed(w->seed, level, (uint32_t)i), &res);
+            t->games++;
+            t->wins += res.won;
+            t->reveals += res.reveals;
+            t->flags += res.flags;
+            t->guesses += res.guesses;
+            t->floods += res.floods;
+            t->flood_cells += res.flood_cells;
+        }
+    }
+    ms_bot_free(bot);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    long long games = 100000;
+    int levels[MS_LEVEL_COUNT];
+    int nlevels = 0;
+    MsTopology topology = MS_TOPO_SQUARE;
+    uint32_t seed = 1;
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:l:t:s:j:")) != -1) {
+        switch (opt) {
+            case 'n': games = atoll(optarg); break;
+            case 'l': {
+                int l = atoi(optarg);
+                if (l < 0 || l >= MS_LEVEL_COUNT || nlevels == MS_LEVEL_COUNT) {
+                    fprintf(stderr, "bad level %s\n", optarg);
+                    return 2;
+                }
+                levels[nlevels++] = l;
+                break;
+            }
+            case 't': {
+                int t = atoi(optarg);
+                if (t < 0 || t >= MS_TOPO_COUNT) {
+                    fprintf(stderr, "bad topology %s\n", optarg);
+                    return 2;
+                }
+                topology = (MsTopology)t;
+                break;
+            }
+            case 's': seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'j': workers = atol(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-n games] [-l level]... [-t topology] [-s seed] [-j workers]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (nlevels == 0) {
+        levels[nlevels++] = MS_EASY;
+        levels[nlevels++] = MS_MEDIUM;
+        levels[nlevels++] = MS_HARD;
+    }
+    if (workers < 1) workers = 1;
+
+    // Every worker owns its board, so threads share nothing but the read-only level table
+    if (workers > 256) workers = 256;
+    Worker *pool = calloc((size_t)workers, sizeof(Worker));
+    if (!pool) { perror("calloc"); return 1; }
+    double start = now_seconds();
+
+    for (int w = 0; w < workers; w++) {
+        Worker *wk = &pool[w];
+        wk->id = w;
+        wk->workers = (int)workers;
+        wk->games = games;
+        wk->levels = levels;
+        wk->nlevels = nlevels;
+        wk->topology = topology;
+        wk->seed = seed;
+        if (pthread_create(&wk->thread, NULL, run_worker, wk) != 0) {
+            fprintf(stderr, "cannot start worker %d\n", w);
+            return 1;
+        }
+    }
+
+    LevelTotals sum[MS_LEVEL_COUNT];
+    memset(sum, 0, sizeof(sum));
+    for (int w = 0; w < workers; w++) {
+        pthread_join(pool[w].thread, NULL);
+        if (pool[w].failed) {
+            fprintf(stderr, "worker %d failed\n", w);
+            return 1;
+        }
+        const LevelTotals *part = pool[w].totals;
+        for (int l = 0; l < MS_LEVEL_COUNT; l++) {
+            sum[l].games += part[l].games;
+            sum[l].wins += part[l].wins;
+            sum[l].reveals += part[l].reveals;
+            sum[l].flags += part[l].flags;
+            sum[l].guesses += part[l].guesses;
+            sum[l].floods += part[l].floods;
+            sum[l].flood_cells += part[l].flood_cells;
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    long long total_games = 0;
+    printf("%-7s %10s %8s %9s %10s %10s %9s %11s\n",
+           "level", "games", "win%", "guess/g", "reveal/g", "flag/g", "flood/g", "cells/flood");
+    for (int li = 0; li < nlevels; li++) {
+        const LevelTotals *t = &sum[levels[li]];
+        double g = t->games ? (double)t->games : 1.0;
+        printf("%-7s %10lld %7.2f%% %9.2f %10.2f %10.2f %9.2f %11.2f\n",
+               level_names[levels[li]], t->games, 100.0 * t->wins / g,
+               t->guesses / g, t->reveals / g, t->flags / g, t->floods / g,
+               t->floods ? (double)t->flood_cells / t->floods : 0.0);
+        total_games += t->games;
+    }
+    printf("%lld games in %.2f s, %.0f games/sec, %ld workers, seed %u, %s boards\n",
+           total_games, elapsed, elapsed > 0 ? total_games / elapsed : 0.0, workers, seed,
+           topology_names[topology]);
+    free(pool);
+    return 0;
+}
@@ -0,0 +1,202 @@
+// Karen, deterministic Minesweeper bot: single-cell rules over a worklist, then the safest looking guess
+#include <stdlib.h>
+#include <string.h>
+#include "ms_bot.h"
+
+MsBot *ms_bot_new(void) {
+    MsBot *bot = calloc(1, sizeof(MsBot));
+    if (bot) bot->board.cells = bot->cells;
+    return bot;
+}
+
+void ms_bot_free(MsBot *bot) {
+    free(bot);
+}
+
+static void enqueue(MsBot *bot, int r, int c) {
+    int i = cell_index(&bot->board, r, c);
+    if (bot->queued[i] || cell_state(&bot->board, r, c) != REVEALED) return;
+    bot->queued[i] = 1;
+    bot->queue[bot->q_tail] = i;
+    bot->q_tail = (bot->q_tail + 1) % MAX_CELLS;
+}
+
+// A cell changed: it and every revealed neighbour may now satisfy a rule. They are queued in
+// row-major order, the cell between its neighbours, since the order decides which rule fires first
+static void mark_changed(MsBot *bot, int r, int c) {
+    const MsNeighbours *nb = cell_neighbours(&bot->board, r, c);
+    int k = 0;
+    for (; k < nb->count && (nb->dr[k] < 0 || (nb->dr[k] == 0 && nb->dc[k] < 0)); ++k)
+        enqueue(bot, r + nb->dr[k], c + nb->dc[k]);
+    enqueue(bot, r, c);
+    for (; k < nb->count; ++k) enqueue(bot, r + nb->dr[k], c + nb->dc[k]);
+}
+
+// Mark the zero region a flood opened, walking revealed zero cells from the clicked one
+static void mark_flood(MsBot *bot, int sr, int sc) {
+    const MinesweeperBoard *b = &bot->board;
+    int top = 0;
+    memset(bot->seen, 0, (size_t)(b->rows * b->cols));
+    bot->stack[top++] = cell_index(b, sr, sc);
+    bot->seen[cell_index(b, sr, sc)] = 1;
+    while (top > 0) {
+        int i = bot->stack[--top];
+        int r = i / b->cols, c = i % b->cols;
+        mark_changed(bot, r, c);
+        if (cell_adj(b, r, c) != 0) continue;
+        const MsNeighbours *nb = cell_neighbours(b, r, c);
+        for (int k = 0; k < nb->count; ++k) {
+            int rr = r + nb->dr[k], cc = c + nb->dc[k];
+            if (cell_state(b, rr, cc) != REVEALED) continue;
+            int j = cell_index(b, rr, cc);
+            if (!bot->seen[j]) {
+                bot->seen[j] = 1;
+                bot->stack[top++] = j;
+            }
+        }
+    }
+}
+
+// Reveal through the game API and keep the flood statistics
+static void bot_reveal(MsBot *bot, int r, int c, MsBotResult *res) {
+    int before = bot->board.revealed_count;
+    reveal_cell(&bot->board, r, c);
+    int opened = bot->board.revealed_count - before;
+    res->reveals++;
+    if (opened > 1) {
+        res->floods++;
+        res->flood_cells += opened;
+        mark_flood(bot, r, c);
+    } else {
+        mark_changed(bot, r, c);
+    }
+}
+
+// Count hidden and flagged neighbours of a cell
+static void count_neighbours(const MinesweeperBoard *b, int r, int c, int *hidden, int *flagged) {
+    *hidden = *flagged = 0;
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    for (int k = 0; k < nb->count; ++k) {
+        CellState st = cell_state(b, r + nb->dr[k], c + nb->dc[k]);
+        if (st == HIDDEN) (*hidden)++;
+        else if (st == FLAGGED) (*flagged)++;
+    }
+}
+
+// Apply the two trivial rules to one revealed number
+static void check_cell(MsBot *bot, int r, int c, MsBotResult *res) {
+    MinesweeperBoard *b = &bot->board;
+    int n = cell_adj(b, r, c);     // Only read for revealed cells, the bot never peeks
+    int hidden, flagged;
+    if (n == 0) return;
+    count_neighbours(b, r, c, &hidden, &flagged);
+    if (hidden == 0) return;
+
+    int all_safe  = (flagged == n);
+    int all_mines = (flagged + hidden == n);
+    if (!all_safe && !all_mines) return;
+
+    const MsNeighbours *nb = cell_neighbours(b, r, c);
+    for (int k = 0; k < nb->count && !b->game_over; ++k) {
+        int rr = r + nb->dr[k], cc = c + nb->dc[k];
+        if (cell_state(b, rr, cc) != HIDDEN) continue;
+        if (all_safe) {
+            bot_reveal(bot, rr, cc, res);
+        } else {
+            toggle_flag(b, rr, cc);
+            res->flags++;
+            mark_changed(bot, rr, cc);
+        }
+    }
+}
+
+// Drain the worklist, returns when nothing is left that a rule can decide
+static void apply_rules(MsBot *bot, MsBotResult *res) {
+    while (bot->q_head != bot->q_tail && !bot->board.game_over) {
+        int i = bot->queue[bot->q_head];
+        bot->q_head = (bot->q_head + 1) % MAX_CELLS;
+        bot->queued[i] = 0;
+        check_cell(bot, i / bot->board.cols, i % bot->board.cols, res);
+    }
+}
+
+// Pick the hidden cell with the lowest estimated mine chance, ties go to the first cell
+static int guess(MsBot *bot, MsBotResult *res) {
+    const MinesweeperBoard *b = &bot->board;
+    float *risk = bot->risk;
+    int cells = b->rows * b->cols;
+    int flags = 0, unknown = 0;
+
+    // Frontier cells take the worst estimate of their revealed neighbours, the rest the global density
+    for (int i = 0; i < cells; ++i) risk[i] = -1.0f;
+    for (int r = 0; r < b->rows; ++r) {
+        for (int c = 0; c < b->cols; ++c) {
+            CellState st = cell_state(b, r, c);
+            if (st == FLAGGED) { flags++; continue; }
+            if (st == HIDDEN) { unknown++; continue; }
+            int n = cell_adj(b, r, c), hidden, flagged;
+            if (n == 0) continue;
+            count_neighbours(b, r, c, &hidden, &flagged);
+            if (hidden == 0) continue;
+            float local = (float)(n - flagged) / hidden;
+            const MsNeighbours *nb = cell_neighbours(b, r, c);
+            for (int k = 0; k < nb->count; ++k) {
+                int rr = r + nb->dr[k], cc = c + nb->dc[k];
+                if (cell_state(b, rr, cc) != HIDDEN) continue;
+                int j = cell_index(b, rr, cc);
+                if (local > risk[j]) risk[j] = local;
+            }
+        }
+    }
+    float density = unknown ? (float)(b->mines - flags) / unknown : 1.0f;
+
+    int best = -1;
+    float best_p = 2.0f;
+    for (int r = 0; r < b->rows; ++r) {
+        for (int c = 0; c < b->cols; ++c) {
+            if (cell_state(b, r, c) != HIDDEN) continue;
+            int i = cell_index(b, r, c);
+            float p = risk[i] < 0.0f ? density : risk[i];
+            if (p < best_p) {
+                best_p = p;
+                best = i;
+            }
+        }
+    }
+
+    if (best < 0) return 0;
+    res->guesses++;
+    bot_reveal(bot, best / b->cols, best % b->cols, res);
+    return 1;
+}
+
+void ms_bot_play(MsBot *bot, MsLevel level, MsTopology topology, uint32_t seed, MsBotResult *out) {
+    MinesweeperBoard *b = &bot->board;
+    MsBotResult res = {0};
+
+    ms_seed(b, seed);
+    start_new_game(b, level, topology);
+    memset(bot->queued, 0, (size_t)(b->rows * b->cols));
+    bot->q_head = bot->q_tail = 0;
+
+    bot_reveal(bot, b->cursor_r, b->cursor_c, &res);  // First click is always safe
+
+    while (!b->game_over) {
+        apply_rules(bot, &res);
+        if (!b->game_over && !guess(bot, &res)) break;
+    }
+
+    res.won = (b->game_over == 2);
+    *out = res;
+}
+
+uint32_t ms_game_seed(uint32_t base, MsLevel level, uint32_t index) {
+    // Murmur3 finalizer over the three inputs
+    uint32_t h = base ^ (0x9E3779B9u * ((uint32_t)level + 1)) ^ (index * 0x85EBCA6Bu);
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
@@ -0,0 +1,39 @@
+// Karen, deterministic Minesweeper bot for the host tools
+#ifndef MS_BOT_H
+#define MS_BOT_H
+
+#include <stdint.h>
+#include "../minesweeper.h"
+
+// Outcome of one bot game
+typedef struct {
+    int won;            // 1 if every safe cell was revealed
+    int reveals;        // reveal_cell calls
+    int flags;          // toggle_flag calls
+    int guesses;        // Reveals not forced by a rule
+    int floods;         // Reveals that opened more than one cell
+    int flood_cells;    // Cells opened by those reveals
+} MsBotResult;
+
+// Bot with its own board and scratch space, one per thread, allocate with ms_bot_new
+typedef struct {
+    MinesweeperBoard board;
+    uint8_t cells[MAX_CELLS];   // board.cells, big enough for every level
+    int queue[MAX_CELLS];       // Revealed cells whose neighbourhood changed and have to be checked again
+    uint8_t queued[MAX_CELLS];
+    int q_head, q_tail;         // Ring indices, at most one entry per cell so it never overflows
+    float risk[MAX_CELLS];      // Estimated mine chance per cell, filled by guess()
+    int stack[MAX_CELLS];       // Flood walk in mark_flood
+    uint8_t seen[MAX_CELLS];
+} MsBot;
+
+MsBot *ms_bot_new(void);
+void ms_bot_free(MsBot *bot);
+
+// Play one seeded game of the given level and board shape to the end on the bot's board
+void ms_bot_play(MsBot *bot, MsLevel level, MsTopology topology, uint32_t seed, MsBotResult *out);
+
+// Seed of game number index in a run, the same (base, level, index) always gives the same board
+uint32_t ms_game_seed(uint32_t base, MsLevel level, uint32_t index);
+
+#endif
@@ -0,0 +1,60 @@
+// Zunjee, Karen, RLE decoder benchmark: every art image decoded into a frame, against copying
+// a raw 320x240 frame a word at a time, the cost of keeping the art unpacked in ROM
+//
+// Usage: rle_bench [-n frames]
+//   -n  decodes per image and raw copies (default 2000)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "dtekv_board.h"
+#include "art.h"
+
+volatile uint8_t sim_vga[SCREEN_W * SCREEN_H] __attribute__((aligned(4)));
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void bench_image(const char *name, const RleImage *img, long n) {
+    int x = (SCREEN_W - img->w) / 2, y = (SCREEN_H - img->h) / 2;
+    double start = now_seconds();
+    for (long i = 0; i < n; i++) rle_draw(img, x, y);
+    double us = (now_seconds() - start) * 1e6 / n;
+    printf("%-12s %3dx%-3d %6lu %8.2f %10.1f\n", name, img->w, img->h, (unsigned long)img->size, us,
+           img->w * img->h / us);
+}
+
+int main(int argc, char **argv) {
+    long n = 2000;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt == 'n') {
+            n = atol(optarg);
+        } else {
+            fprintf(stderr, "usage: %s [-n frames]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("%-12s %7s %6s %8s %10s\n", "image", "size", "bytes", "us", "Mpixel/s");
+    bench_image("menu_bg", &art_menu_bg, n);
+    bench_image("trophy", &art_trophy, n);
+    bench_image("mine_burst", &art_mine_burst, n);
+
+    // The same full screen kept raw: 76800 bytes of ROM, copied as words
+    static uint32_t raw[SCREEN_W * SCREEN_H / 4];
+    rle_draw(&art_menu_bg, 0, 0);
+    memcpy(raw, (const void *)sim_vga, sizeof raw);
+    volatile uint32_t *fb = (volatile uint32_t *)sim_vga;
+    double start = now_seconds();
+    for (long i = 0; i < n; i++)
+        for (int k = 0; k < SCREEN_W * SCREEN_H / 4; k++) fb[k] = raw[k];
+    double us = (now_seconds() - start) * 1e6 / n;
+    printf("%-12s %3dx%-3d %6d %8.2f %10.1f\n", "raw copy", SCREEN_W, SCREEN_H, SCREEN_W * SCREEN_H, us,
+           SCREEN_W * SCREEN_H / us);
+    return 0;
+}
@@ -0,0 +1,202 @@
+// Zunjee, Karen, RLE art converter: PPM images to RGB332 run-length streams as C source
+//
+// Usage: rle_pack -o out [-k RGB332] name=image.ppm ...
+//   -o  writes out.c and out.h, one const RleImage art_<name> per image
+//   -k  transparent color (hex RGB332, e.g. E3) for the images after it, -k none turns it off
+// Binary PPM (P6, maxval 255) in, the format is described in rle.h
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../rle.h"
+
+#define MAX_IMAGES 32
+#define NAME_MAX_LEN 32     // Longest image name, art_<name> has to stay a short C identifier
+
+typedef struct {
+    char name[NAME_MAX_LEN + 1];
+    int w, h, key;
+    uint8_t *pixels;        // RGB332
+    uint8_t *data;          // Encoded stream
+    size_t size;
+} Image;
+
+// Names become C identifiers in the generated files: letters, digits and '_', not starting with a digit
+static int valid_name(const char *name, int len) {
+    if (len < 1 || len > NAME_MAX_LEN || (name[0] >= '0' && name[0] <= '9')) return 0;
+    for (int i = 0; i < len; i++) {
+        char ch = name[i];
+        if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_')) return 0;
+    }
+    return 1;
+}
+
+static int ppm_token(FILE *f) {
+    int c, v = 0;
+    do {
+        c = fgetc(f);
+        if (c == '#') while (c != '\n' && c != EOF) c = fgetc(f);
+    } while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    if (c < '0' || c > '9') return -1;
+    for (; c >= '0' && c <= '9'; c = fgetc(f)) v = v * 10 + (c - '0');
+    return v;   // The single whitespace after the value is consumed
+}
+
+// Nearest RGB332 color, 3 bits of red and green, 2 of blue
+static uint8_t rgb332(int r, int g, int b) {
+    return (uint8_t)(((r * 7 + 127) / 255) << 5 | ((g * 7 + 127) / 255) << 2 | (b * 3 + 127) / 255);
+}
+
+static int load_ppm(Image *img, const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    int ok = fgetc(f) == 'P' && fgetc(f) == '6';
+    img->w = ok ? ppm_token(f) : -1;
+    img->h = ok ? ppm_token(f) : -1;
+    int maxval = ok ? ppm_token(f) : -1;
+    if (img->w <= 0 || img->h <= 0 || img->w > 0xFFFF || img->h > 0xFFFF || maxval != 255) {
+        fprintf(stderr, "%s: not a binary PPM with maxval 255\n", path);
+        fclose(f);
+        return 0;
+    }
+    size_t n = (size_t)img->w * img->h;
+    uint8_t *rgb = malloc(n * 3);
+    img->pixels = malloc(n);
+    if (fread(rgb, 3, n, f) != n) {
+        fprintf(stderr, "%s: short pixel data\n", path);
+        fclose(f);
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) img->pixels[i] = rgb332(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+    free(rgb);
+    fclose(f);
+    return 1;
+}
+
+// Pending literal row[from, to) as ops of at most RLE_MAX_RUN pixels
+static uint8_t *flush_literal(uint8_t *out, const uint8_t *row, int from, int to) {
+    while (from < to) {
+        int k = to - from > RLE_MAX_RUN ? RLE_MAX_RUN : to - from;
+        *out++ = (uint8_t)(0x7F + k);
+        memcpy(out, row + from, (size_t)k);
+        out += k;
+        from += k;
+    }
+    return out;
+}
+
+// Runs of 3 or more, and every key pixel, become run ops, the rest gathers into literals
+static void encode(Image *img) {
+    img->data = malloc((size_t)img->w * img->h * 2);
+    uint8_t *out = img->data;
+    for (int y = 0; y < img->h; y++) {
+        const uint8_t *row = img->pixels + (size_t)y * img->w;
+        int lit = 0;        // Start of the pending literal, up to x
+        for (int x = 0; x < img->w;) {
+            int n = 1;
+            while (x + n < img->w && row[x + n] == row[x] && n < RLE_MAX_RUN) n++;
+            if (n >= 3 || row[x] == img->key) {
+                out = flush_literal(out, row, lit, x);
+                *out++ = (uint8_t)(n - 1);
+                *out++ = row[x];
+                lit = x + n;
+            }
+            x += n;
+        }
+        out = flush_literal(out, row, lit, img->w);
+    }
+    img->size = (size_t)(out - img->data);
+}
+
+// Decode the stream again and compare, key pixels included
+static int verify(const Image *img) {
+    const uint8_t *s = img->data;
+    for (int y = 0; y < img->h; y++) {
+        const uint8_t *row = img->pixels + (size_t)y * img->w;
+        for (int x = 0; x < img->w;) {
+            int op = *s++;
+            int n = op < 0x80 ? op + 1 : op - 0x7F;
+            if (x + n > img->w) return 0;
+            for (int i = 0; i < n; i++)
+                if (row[x + i] != (op < 0x80 ? s[0] : s[i])) return 0;
+            s += op < 0x80 ? 1 : n;
+            x += n;
+        }
+    }
+    return (size_t)(s - img->data) == img->size;
+}
+
+int main(int argc, char **argv) {
+    static Image images[MAX_IMAGES];
+    int count = 0, key = RLE_NO_KEY;
+    const char *out = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            out = argv[++i];
+        } else if (!strcmp(argv[i], "-k") && i + 1 < argc) {
+            i++;
+            key = strcmp(argv[i], "none") ? (int)strtol(argv[i], NULL, 16) & 0xFF : RLE_NO_KEY;
+        } else if (strchr(argv[i], '=') && count < MAX_IMAGES) {
+            Image *img = &images[count++];
+            const char *eq = strchr(argv[i], '=');
+            if (!valid_name(argv[i], (int)(eq - argv[i]))) {
+                fprintf(stderr, "%.*s: image names are C identifiers of at most %d characters\n",
+                        (int)(eq - argv[i]), argv[i], NAME_MAX_LEN);
+                return 2;
+            }
+            snprintf(img->name, sizeof img->name, "%.*s", (int)(eq - argv[i]), argv[i]);
+            img->key = key;
+            if (!load_ppm(img, eq + 1)) return 1;
+            encode(img);
+            if (!verify(img)) {
+                fprintf(stderr, "%s: stream does not decode back to the image\n", img->name);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "usage: %s -o out [-k RGB332] name=image.ppm ...\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!out || count == 0) {
+        fprintf(stderr, "usage: %s -o out [-k RGB332] name=image.ppm ...\n", argv[0]);
+        return 2;
+    }
+
+    char path[512];
+    snprintf(path, sizeof path, "%s.h", out);
+    FILE *h = fopen(path, "w");
+    snprintf(path, sizeof path, "%s.c", out);
+    FILE *c = fopen(path, "w");
+    if (!h || !c) {
+        perror(path);
+        return 1;
+    }
+    const char *base = strrchr(out, '/') ? strrchr(out, '/') + 1 : out;
+    fprintf(h, "// Generated by tools/rle_pack from tools/art, run make -C tools art after changing an image\n");
+    fprintf(h, "#ifndef ART_H\n#define ART_H\n\n#include \"rle.h\"\n\n");
+    fprintf(c, "// Generated by tools/rle_pack from tools/art, run make -C tools art after changing an image\n");
+    fprintf(c, "#include \"%s.h\"\n", base);
+    size_t raw = 0, packed = 0;
+    for (int i = 0; i < count; i++) {
+        Image *img = &images[i];
+        char decl[sizeof "extern const RleImage art_;" + NAME_MAX_LEN];
+        snprintf(decl, sizeof decl, "extern const RleImage art_%.*s;", NAME_MAX_LEN, img->name);
+        fprintf(h, "%-40s // %dx%d, %zu bytes\n", decl, img->w, img->h, img->size);
+        fprintf(c, "\nstatic const uint8_t %s_data[%zu] = {", img->name, img->size);
+        for (size_t k = 0; k < img->size; k++) fprintf(c, "%s0x%02X,", k % 16 ? " " : "\n    ", img->data[k]);
+        fprintf(c, "\n};\n\nconst RleImage art_%s = { %d, %d, %d, %zu, %s_data };\n",
+                img->name, img->w, img->h, img->key, img->size, img->name);
+        fprintf(stderr, "%-12s %3dx%-3d %6d raw %6zu rle (%.1f%%)\n", img->name, img->w, img->h,
+                img->w * img->h, img->size, 100.0 * img->size / (img->w * img->h));
+        raw += (size_t)img->w * img->h;
+        packed += img->size;
+    }
+    fprintf(h, "\n#endif\n");
+    fprintf(stderr, "total        %6zu raw %6zu rle\n", raw, packed);
+    fclose(h);
+    fclose(c);
+    return 0;
+}
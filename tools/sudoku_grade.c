@@ -0,0 +1,94 @@
+// Zunjee, headless Sudoku grader: solves generated puzzles with the hint engine alone and reports
+// the hardest technique each one needs
+//
+// Usage: sudoku_grade [-n puzzles] [-s first_id]
+//   -n  puzzles per size and difficulty (default 10000)
+//   -s  puzzle ID of the first puzzle (default 1), puzzle i has ID first_id + i, so any of them
+//       can be replayed on the board
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "sudoku.h"
+#include "sudoku_hint.h"
+
+static const char *difficulty_names[3] = { "EASY", "MEDIUM", "HARD" };
+static const char *size_names[5] = { "", "", "4X4", "9X9", "16X16" };
+
+// Puzzles of one size and difficulty by the hardest technique they needed, TECH_NONE for stuck ones
+typedef struct {
+    long long puzzles;
+    long long graded[TECH_COUNT];
+    long long steps;
+    long long wrong;        // Hints that disagree with the solution, should stay 0
+} GradeTotals;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Take hints until the grid is full or none is left, returns the hardest technique or TECH_NONE
+static SudokuTechnique grade(SudokuGame *game, GradeTotals *t) {
+    SudokuTechnique hardest = TECH_NAKED_SINGLE;
+    SudokuHint hint;
+    while (!sudoku_is_full(game)) {
+        if (!sudoku_hint_find(game, &hint) || hint.technique == TECH_CONFLICT) return TECH_NONE;
+        if (hint.digit != game->solution[hint.row][hint.col]) t->wrong++;
+        game->grid.cells[hint.row][hint.col].value = hint.digit;
+        sudoku_hint_note(game, hint.row, hint.col, 0);
+        if (hint.technique > hardest) hardest = hint.technique;
+        t->steps++;
+    }
+    return hardest;
+}
+
+int main(int argc, char **argv) {
+    long long n = 10000;
+    uint32_t first_id = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+            case 'n': n = atoll(optarg); break;
+            case 's': first_id = (uint32_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-n puzzles] [-s first_id]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    static SudokuGame game;
+    GradeTotals totals[5][3] = { 0 };
+    long long wrong = 0, puzzles = 0;
+    double start = now_seconds();
+    for (int order = SUDOKU_4X4; order <= SUDOKU_16X16; order++) {
+        for (int d = EASY; d <= HARD; d++) {
+            GradeTotals *t = &totals[order][d];
+            for (long long i = 0; i < n; i++) {
+                sudoku_generate(&game, (SudokuDifficulty)d, (SudokuOrder)order, first_id + (uint32_t)i);
+                t->graded[grade(&game, t)]++;
+                t->puzzles++;
+            }
+            wrong += t->wrong;
+            puzzles += t->puzzles;
+        }
+    }
+    double secs = now_seconds() - start;
+
+    printf("%-12s %9s %9s %9s %9s %9s %9s %7s\n",
+           "level", "puzzles", "naked1", "hidden1", "pointing", "nakedpair", "unsolved", "steps");
+    for (int order = SUDOKU_4X4; order <= SUDOKU_16X16; order++) {
+        for (int d = EASY; d <= HARD; d++) {
+            const GradeTotals *t = &totals[order][d];
+            char level[16];
+            snprintf(level, sizeof level, "%s %s", difficulty_names[d], size_names[order]);
+            printf("%-12s %9lld %9lld %9lld %9lld %9lld %9lld %7.1f\n", level, t->puzzles,
+                   t->graded[TECH_NAKED_SINGLE], t->graded[TECH_HIDDEN_SINGLE], t->graded[TECH_POINTING_PAIR],
+                   t->graded[TECH_NAKED_PAIR], t->graded[TECH_NONE], (double)t->steps / t->puzzles);
+        }
+    }
+    printf("%lld puzzles in %.2f s, %.0f puzzles/sec, IDs from %08X\n", puzzles, secs, puzzles / secs, first_id);
+    if (wrong) fprintf(stderr, "%lld hints disagree with the solution\n", wrong);
+    return wrong != 0;
+}
@@ -0,0 +1,189 @@
+// Zunjee, Karen, screen transitions: the VGA DMA shows a RAM frame while the new screen draws into the
+// framebuffer, and the steps are composed into that frame a row at a time within the tick's pixel budget
+#include <stdint.h>
+#include "transition.h"
+#include "mmio.h"
+#include "timer.h"
+#include "key_repeat.h"
+#include "profile.h"
+#include "sudoku_vga.h"
+
+#define FRAME_BYTES (SCREEN_W * SCREEN_H)
+#define FADE_LEVELS (TRANSITION_STEPS / 2)                      // Brightness levels on each side of black
+#define WIPE_ROWS (SCREEN_H / TRANSITION_STEPS)                 // Rows a wipe step copies
+#define DISSOLVE_TILE 16
+#define DISSOLVE_COLS (DISSOLVE_TILE / TRANSITION_STEPS)        // Columns of a tile row a dissolve step brings in
+
+_Static_assert(SCREEN_H % TRANSITION_STEPS == 0, "wipe steps would not cover the screen");
+_Static_assert(SCREEN_W % DISSOLVE_TILE == 0 && DISSOLVE_TILE % TRANSITION_STEPS == 0,
+               "dissolve steps would not cover the screen");
+
+typedef enum {
+    PHASE_IDLE,
+    PHASE_CAPTURE,      // Next screen drawing its first frame into the framebuffer, shown_screen on the DMA
+    PHASE_RUN           // Steps being composed into shown_screen
+} Phase;
+
+static uint8_t old_screen[FRAME_BYTES] __attribute__((aligned(4)));     // Only kept for a fade
+static uint8_t shown_screen[FRAME_BYTES] __attribute__((aligned(4)));   // Scanned out until the last step
+
+static Phase phase = PHASE_IDLE;
+static TransitionKind kind;
+static int step;                // Step being composed
+static int row;                 // Next row of it
+static uint32_t start_ms;
+static int key_down;            // KEY1 at the last poll, only a new press ends the transition
+
+// Fade level l scales each channel by l / FADE_LEVELS, level FADE_LEVELS is the identity
+static uint8_t fade_lut[FADE_LEVELS + 1][256];
+// Per tile row, its columns in the order the dissolve brings them in
+static uint8_t dissolve_cols[DISSOLVE_TILE][DISSOLVE_TILE];
+static int tables_ready = 0;
+
+static uint8_t scale_channel(int c, int level) {
+    return (uint8_t)((2 * c * level + FADE_LEVELS) / (2 * FADE_LEVELS));     // Rounded to nearest
+}
+
+static void build_tables(void) {
+    for (int l = 0; l <= FADE_LEVELS; l++) {
+        for (int p = 0; p < 256; p++) {
+            fade_lut[l][p] = (uint8_t)(scale_channel(p >> 5, l) << 5 | scale_channel((p >> 2) & 7, l) << 2 |
+                                       scale_channel(p & 3, l));
+        }
+    }
+
+    // Every tile row a different shuffle, so no column comes in as a straight line
+    uint32_t rng = 0x2545F491u;
+    for (int r = 0; r < DISSOLVE_TILE; r++) {
+        uint8_t *cols = dissolve_cols[r];
+        for (int c = 0; c < DISSOLVE_TILE; c++) cols[c] = (uint8_t)c;
+        for (int c = DISSOLVE_TILE - 1; c > 0; c--) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            int k = (int)(rng % (uint32_t)(c + 1));
+            uint8_t t = cols[c];
+            cols[c] = cols[k];
+            cols[k] = t;
+        }
+    }
+    tables_ready = 1;
+}
+
+// Row y of the new screen, read from the framebuffer as one span
+static const volatile uint32_t *next_row(int y) {
+    return (const volatile uint32_t *)fb_span_read(y * SCREEN_W, SCREEN_W);
+}
+
+// A row through a fade table into row y of the shown frame, four pixels a word
+static void fade_row(const volatile uint32_t *s, int y, const uint8_t *lut) {
+    uint32_t *d = (uint32_t *)(shown_screen + y * SCREEN_W);
+    for (int i = 0; i < SCREEN_W / 4; i++) {
+        uint32_t w = s[i];
+        d[i] = (uint32_t)lut[w & 0xFF] | (uint32_t)lut[(w >> 8) & 0xFF] << 8 |
+               (uint32_t)lut[(w >> 16) & 0xFF] << 16 | (uint32_t)lut[w >> 24] << 24;
+    }
+}
+
+// Row y of the new screen into the shown frame, a word at a time
+static void copy_row(int y) {
+    const volatile uint32_t *s = next_row(y);
+    uint32_t *d = (uint32_t *)(shown_screen + y * SCREEN_W);
+    for (int i = 0; i < SCREEN_W / 4; i++) d[i] = s[i];
+}
+
+// The new screen's pixels of row y that step s brings in, the same columns of every tile
+static void dissolve_row(int y, int s) {
+    const uint8_t *cols = &dissolve_cols[y % DISSOLVE_TILE][s * DISSOLVE_COLS];
+    uint8_t *d = shown_screen + y * SCREEN_W;
+    for (int k = 0; k < DISSOLVE_COLS; k++)
+        for (int x = cols[k]; x < SCREEN_W; x += DISSOLVE_TILE) d[x] = fb_read(y * SCREEN_W + x);
+}
+
+// Rows [first, end) of the current step
+static int step_first(void) {
+    return kind == TRANSITION_WIPE ? step * WIPE_ROWS : 0;
+}
+
+static int step_end(void) {
+    return kind == TRANSITION_WIPE ? (step + 1) * WIPE_ROWS : SCREEN_H;
+}
+
+// Composes row y of the current step, returns the pixels it wrote. The last step is not composed,
+// the DMA goes back to the framebuffer, which holds the whole new screen by then.
+static int compose_row(int y) {
+    switch (kind) {
+        case TRANSITION_FADE:
+            if (step < FADE_LEVELS) {
+                const uint32_t *old = (const uint32_t *)(old_screen + y * SCREEN_W);
+                fade_row(old, y, fade_lut[FADE_LEVELS - 1 - step]);     // Down to black on the last one
+            } else {
+                fade_row(next_row(y), y, fade_lut[step - FADE_LEVELS + 1]);
+            }
+            return SCREEN_W;
+        case TRANSITION_DISSOLVE:
+            dissolve_row(y, step);
+            return SCREEN_W / DISSOLVE_TILE * DISSOLVE_COLS;
+        default:
+            copy_row(y);
+            return SCREEN_W;
+    }
+}
+
+void transition_begin(TransitionKind k) {
+    int showing = phase != PHASE_IDLE;      // Left mid-transition, shown_screen is still what is on screen
+    phase = PHASE_IDLE;
+    if (k == TRANSITION_NONE) {
+        if (showing) mmio_vga_show(MMIO_FB_BASE);
+        return;
+    }
+    if (!tables_ready) build_tables();
+
+    uint32_t *shown = (uint32_t *)shown_screen;
+    if (!showing) {
+        const volatile uint32_t *s = (const volatile uint32_t *)fb_span_read(0, FRAME_BYTES);
+        for (int i = 0; i < FRAME_BYTES / 4; i++) shown[i] = s[i];
+        mmio_vga_show(shown_screen);
+    }
+    if (k == TRANSITION_FADE) {
+        uint32_t *d = (uint32_t *)old_screen;
+        for (int i = 0; i < FRAME_BYTES / 4; i++) d[i] = shown[i];
+    }
+    kind = k;
+    start_ms = timer_ms();
+    key_down = key1_down(mmio_keys());      // The press that picked the screen is usually still held
+    phase = PHASE_CAPTURE;
+}
+
+int transition_capture_end(void) {
+    if (phase != PHASE_CAPTURE) return 0;
+    phase = PHASE_RUN;
+    step = 0;
+    row = step_first();
+    return 1;
+}
+
+int transition_running(void) {
+    return phase == PHASE_RUN;
+}
+
+void transition_step(void) {
+    int down = key1_down(mmio_keys());
+    int pressed = down && !key_down;
+    key_down = down;
+
+    if (pressed || (uint32_t)(timer_ms() - start_ms) >= TRANSITION_MAX_MS) step = TRANSITION_STEPS - 1;
+
+    if (step == TRANSITION_STEPS - 1) {
+        mmio_vga_show(MMIO_FB_BASE);
+        phase = PHASE_IDLE;
+    } else {
+        PROF_BEGIN(PROF_TRANSITION);
+        for (int budget = TRANSITION_PX_PER_TICK; budget > 0 && row < step_end();) budget -= compose_row(row++);
+        PROF_END(PROF_TRANSITION);
+        if (row < step_end()) return;
+        step++;
+        row = step_first();
+    }
+    vga_present();
+}
@@ -0,0 +1,36 @@
+// Zunjee, Karen, screen transitions: the next screen is rendered off screen, then faded, wiped or
+// dissolved in over a few presented frames, a fixed share of the screen per scheduler tick
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include "dtekv_board.h"
+
+// How a screen appears when the scheduler switches to it
+typedef enum {
+    TRANSITION_NONE,        // Drawn straight over the old screen
+    TRANSITION_FADE,        // Old screen down to black, then the new one up from black, through RGB332 tables
+    TRANSITION_WIPE,        // New screen copied in top to bottom, one span per row
+    TRANSITION_DISSOLVE,    // New screen's pixels come in scattered, the same columns in every 16x16 tile
+    TRANSITION_KIND_COUNT
+} TransitionKind;
+
+#define TRANSITION_STEPS 8                  // Presented frames, a fade spends half going out and half coming in
+#define TRANSITION_PX_PER_TICK (SCREEN_W * 60)  // Pixels composed per tick, a quarter of the screen
+#define TRANSITION_MAX_MS 150               // Longest the new screen waits for input, then it is copied in whole
+
+// The scheduler is switching screens: the VGA DMA is pointed at a RAM copy of what is shown, so the
+// next screen's first frame draws into the framebuffer unseen. Call before the next state's enter.
+void transition_begin(TransitionKind kind);
+
+// Called first thing by vga_present, 1 when the frame was the next screen's first and is not shown yet
+int transition_capture_end(void);
+
+// Composing frames, the new screen's update still runs every tick but its render waits
+int transition_running(void);
+
+// One tick's share: a present after each finished step, the last one points the DMA back at the
+// framebuffer. A KEY1 press or TRANSITION_MAX_MS skips to it, call this before the update so the press
+// is drawn in the same tick.
+void transition_step(void);
+
+#endif